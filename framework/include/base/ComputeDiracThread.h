@@ -40,7 +40,6 @@ public:
   virtual ~ComputeDiracThread();
 
   virtual void subdomainChanged();
-  virtual void pre();
   virtual void onElement(const Elem *elem);
   virtual void postElement(const Elem * /*elem*/);
   virtual void post();
@@ -12,34 +12,42 @@
 /*            See COPYRIGHT for full restrictions               */
 /****************************************************************/
 
-#ifndef COMPUTEJACOBIANBLOCKTHREAD_H
-#define COMPUTEJACOBIANBLOCKTHREAD_H
+#ifndef COMPUTEJACOBIANBLOCKSTHREAD_H
+#define COMPUTEJACOBIANBLOCKSTHREAD_H
 
 #include "ThreadedElementLoop.h"
 // libMesh includes
 #include "libmesh/elem_range.h"
 
-class ComputeJacobianBlockThread
+class JacobianBlock;
+
+/**
+ * Assembles several (ivar, jvar) blocks of the Jacobian in one sweep over the elements. The
+ * element and face reinits and the materials are shared by all the blocks. The (ivar, jvar)
+ * pairs of the blocks must be unique.
+ */
+class ComputeJacobianBlocksThread
 {
 public:
-  ComputeJacobianBlockThread(FEProblem & fe_problem, libMesh::System & precond_system, SparseMatrix<Number> & jacobian, unsigned int ivar, unsigned int jvar);
-  ComputeJacobianBlockThread(ComputeJacobianBlockThread & x, Threads::split split);
-  virtual ~ComputeJacobianBlockThread();
+  ComputeJacobianBlocksThread(FEProblem & fe_problem, std::vector<JacobianBlock *> & blocks);
+  ComputeJacobianBlocksThread(ComputeJacobianBlocksThread & x, Threads::split split);
+  virtual ~ComputeJacobianBlocksThread();
 
   void operator() (const ConstElemRange & range, bool bypass_threading=false);
 
-  void join(const ComputeJacobianBlockThread & /*y*/);
+  void join(const ComputeJacobianBlocksThread & /*y*/);
 
 protected:
   THREAD_ID _tid;
 
   FEProblem & _fe_problem;
-  libMesh::System & _precond_system;
   NonlinearSystem & _nl;
 
   MooseMesh & _mesh;
-  SparseMatrix<Number> & _jacobian;
-  unsigned int _ivar, _jvar;
+  std::vector<JacobianBlock *> & _blocks;
+
+  /// Element dof indices of every block (in its precond system), empty if the element has none
+  std::vector<std::vector<dof_id_type> > _dof_indices;
 };
 
-#endif /* COMPUTEJACOBIANBLOCKTHREAD_H */
+#endif /* COMPUTEJACOBIANBLOCKSTHREAD_H */
@@ -87,6 +87,7 @@ public:
   virtual void prepare(const Elem * elem, THREAD_ID tid);
   virtual void prepareFace(const Elem * elem, THREAD_ID tid);
   virtual void prepare(const Elem * elem, unsigned int ivar, unsigned int jvar, const std::vector<dof_id_type> & dof_indices, THREAD_ID tid);
+  virtual void prepareBlock(unsigned int ivar, unsigned int jvar, const std::vector<dof_id_type> & dof_indices, THREAD_ID tid);
   virtual void prepareAssembly(THREAD_ID tid);
   virtual void prepareAssemblyNeighbor(THREAD_ID tid);
 
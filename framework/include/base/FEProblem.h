@@ -239,6 +239,7 @@ public:
   virtual void prepare(const Elem * elem, THREAD_ID tid);
   virtual void prepareFace(const Elem * elem, THREAD_ID tid);
   virtual void prepare(const Elem * elem, unsigned int ivar, unsigned int jvar, const std::vector<dof_id_type> & dof_indices, THREAD_ID tid);
+  virtual void prepareBlock(unsigned int ivar, unsigned int jvar, const std::vector<dof_id_type> & dof_indices, THREAD_ID tid);
 
   virtual void prepareAssembly(THREAD_ID tid);
 
@@ -323,6 +324,12 @@ public:
 
   // NL /////
   NonlinearSystem & getNonlinearSystem() { return _nl; }
+
+  /**
+   * Whether the nonlinear system is currently computing a Jacobian (as opposed to a residual)
+   */
+  bool currentlyComputingJacobian() { return _nl.currentlyComputingJacobian(); }
+
   void addVariable(const std::string & var_name, const FEType & type, Real scale_factor, const std::set< SubdomainID > * const active_subdomains = NULL);
   void addScalarVariable(const std::string & var_name, Order order, Real scale_factor = 1.);
   void addKernel(const std::string & kernel_name, const std::string & name, InputParameters parameters);
@@ -567,6 +574,13 @@ public:
   virtual void computeResidualType(const NumericVector<Number> & soln, NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_ALL);
   virtual void computeJacobian(NonlinearImplicitSystem & sys, const NumericVector<Number> & soln, SparseMatrix<Number> &  jacobian);
   virtual void computeJacobianBlock(SparseMatrix<Number> &  jacobian, libMesh::System & precond_system, unsigned int ivar, unsigned int jvar);
+
+  /**
+   * Computes several Jacobian blocks at once, updating the displaced mesh and the aux system
+   * only once and sweeping the mesh a single time
+   * @param blocks The blocks to fill
+   */
+  virtual void computeJacobianBlocks(std::vector<JacobianBlock *> & blocks);
   virtual Real computeDamping(const NumericVector<Number>& soln, const NumericVector<Number>& update);
 
   /**
@@ -20,6 +20,8 @@
 #include "libmesh/parallel.h"
 #include "libmesh/libmesh_common.h"
 #include "XTermConstants.h"
+#include "MooseProfiler.h"
+#include "AsyncWriter.h"
 
 #include <string>
 
@@ -83,6 +85,16 @@ extern PerfLog perf_log;
  */
 extern PerfLog setup_perf_log;
 
+/**
+ * Profiler used for the solve sections of the framework, see MOOSE_PROFILE_PUSH and MOOSE_PROFILE_POP.
+ */
+extern MooseProfiler profiler;
+
+/**
+ * Background thread writing output files, see AsyncWriter.
+ */
+extern AsyncWriter async_writer;
+
 /**
  * A static list of all the exec types.
  */
@@ -28,6 +28,7 @@
 #include "Factory.h"
 #include "ActionFactory.h"
 #include "OutputWarehouse.h"
+#include "ObjectProfiler.h"
 
 // libMesh includes
 #include "libmesh/parallel_object.h"
@@ -322,6 +323,11 @@ public:
    */
   SystemInfo * getSystemInfo() { return _sys_info; }
 
+  /**
+   * The per-object timing of this App, enabled with --object-timing
+   */
+  ObjectProfiler & getObjectProfiler() { return _object_profiler; }
+
 protected:
 
   MooseApp(const std::string & name, InputParameters parameters);
@@ -421,6 +427,9 @@ protected:
   /// Legacy Uo Initialization flag
   bool _legacy_uo_initialization_default;
 
+  /// Execution time and call count of the objects of this App
+  ObjectProfiler _object_profiler;
+
 private:
 
   ///@{
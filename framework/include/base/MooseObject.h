@@ -76,6 +76,11 @@ public:
    */
   MooseApp & getMooseApp() { return _app; }
 
+  /**
+   * Id of this object in the ObjectProfiler of its app, libMesh::invalid_uint when object timing is disabled
+   */
+  unsigned int objectProfilerId() const { return _object_profiler_id; }
+
 protected:
 
   /// The name of this object
@@ -89,6 +94,9 @@ protected:
 
   /// An instance of helper class to write streams to the Console objects
   const ConsoleStream _console;
+
+  /// Id of this object in the ObjectProfiler
+  const unsigned int _object_profiler_id;
 };
 
 #endif /* MOOSEOBJECT_H*/
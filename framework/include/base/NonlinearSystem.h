@@ -25,6 +25,7 @@
 #include "SplitWarehouse.h"
 #include "TimeIntegrator.h"
 #include "Predictor.h"
+#include "VariableNorms.h"
 
 // libMesh includes
 #include "libmesh/transient_system.h"
@@ -39,6 +40,26 @@
 class FEProblem;
 class MoosePreconditioner;
 
+/**
+ * A block (ivar, jvar) of the Jacobian, stored in a matrix of the (single variable) system
+ * precond_system, see NonlinearSystem::computeJacobianBlocks().
+ */
+class JacobianBlock
+{
+public:
+  JacobianBlock(libMesh::System & precond_system, SparseMatrix<Number> & jacobian, unsigned int ivar, unsigned int jvar) :
+      _precond_system(precond_system),
+      _jacobian(jacobian),
+      _ivar(ivar),
+      _jvar(jvar)
+  {
+  }
+
+  libMesh::System & _precond_system;
+  SparseMatrix<Number> & _jacobian;
+  unsigned int _ivar, _jvar;
+};
+
 /**
  * Nonlinear system to be solved
  *
@@ -67,6 +88,7 @@ public:
   virtual void timestepSetup();
 
   void setupFiniteDifferencedPreconditioner();
+  void destroyFiniteDifferencedColoring();
   void setupDecomposition();
   void setupSplitBasedPreconditioner();
 
@@ -228,6 +250,13 @@ public:
    */
   void computeJacobianBlock(SparseMatrix<Number> & jacobian, libMesh::System & precond_system, unsigned int ivar, unsigned int jvar);
 
+  /**
+   * Computes several Jacobian blocks in a single sweep over the mesh, the materials are
+   * evaluated once per element for all of them
+   * @param blocks The blocks to fill, the matrices are zeroed first
+   */
+  void computeJacobianBlocks(std::vector<JacobianBlock *> & blocks);
+
   /**
    * Compute damping
    * @param update
@@ -292,6 +321,16 @@ public:
    */
   void useFiniteDifferencedPreconditioner(bool use = true) { _use_finite_differenced_preconditioner = use; }
 
+  /**
+   * Rebuild the finite differenced preconditioner only every lag nonlinear iterations
+   */
+  void setFiniteDifferencedJacobianLag(unsigned int lag) { _fd_jacobian_lag = lag; }
+
+  /**
+   * Called when the mesh changed, drops the coloring of the finite differenced preconditioner
+   */
+  void meshChanged();
+
   /**
    * If called with a single string, it is used as the name of a the top-level decomposition split.
    * If the array is empty, no decomposition is used.
@@ -354,6 +393,12 @@ public:
    */
   unsigned int nResidualEvaluations() { return _n_residual_evaluations; }
 
+  /**
+   * The norms of the last residual (the rhs of the system) restricted to each variable and block.
+   * They are computed (collectively) at most once per residual evaluation.
+   */
+  const VariableNorms & residualVariableNorms();
+
   /**
    * Return the final nonlinear residual
    */
@@ -468,6 +513,15 @@ protected:
   void enforceNodalConstraintsResidual(NumericVector<Number> & residual);
   void enforceNodalConstraintsJacobian(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Copy a local row of the assembled jacobian with a single call into the matrix
+   * @param row The global row number, it must be owned by this processor
+   * @param cols The (sorted) columns of the nonzeros in the row
+   * @param values The values of the nonzeros in the row
+   * @return false if the matrix does not allow reading whole rows
+   */
+  bool getJacobianRow(SparseMatrix<Number> & jacobian, dof_id_type row, std::vector<dof_id_type> & cols, std::vector<Number> & values);
+
 
   /// solution vector from nonlinear solver
   const NumericVector<Number> * _current_solution;
@@ -524,6 +578,10 @@ protected:
 #ifdef LIBMESH_HAVE_PETSC
   MatFDColoring _fdcoloring;
 #endif
+  /// Whether _fdcoloring was built for the current mesh, it is reused by all solves until the mesh changes
+  bool _have_fdcoloring;
+  /// Number of nonlinear iterations the finite differenced preconditioner is kept for
+  unsigned int _fd_jacobian_lag;
   /// Whether or not the system can be decomposed into splits
   bool _have_decomposition;
   /// Name of the top-level split of the decomposition
@@ -559,6 +617,13 @@ protected:
   /// Total number of residual evaluations that have been performed
   unsigned int _n_residual_evaluations;
 
+  /// Per variable norms of the residual
+  VariableNorms _residual_norms;
+  /// Whether _residual_norms is up to date
+  bool _residual_norms_valid;
+  /// The residual evaluation _residual_norms were computed for
+  unsigned int _residual_norms_evaluation;
+
   Real _final_residual;
 
   /// If predictor is active, this is non-NULL
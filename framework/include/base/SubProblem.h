@@ -133,6 +133,8 @@ public:
   virtual void prepare(const Elem * elem, THREAD_ID tid) = 0;
   virtual void prepareFace(const Elem * elem, THREAD_ID tid) = 0;
   virtual void prepare(const Elem * elem, unsigned int ivar, unsigned int jvar, const std::vector<dof_id_type> & dof_indices, THREAD_ID tid) = 0;
+  /// Size and zero one more (ivar, jvar) block on an element already prepared with the method above
+  virtual void prepareBlock(unsigned int ivar, unsigned int jvar, const std::vector<dof_id_type> & dof_indices, THREAD_ID tid) = 0;
   virtual void prepareAssembly(THREAD_ID tid) = 0;
 
   virtual void reinitElem(const Elem * elem, THREAD_ID tid) = 0;
@@ -226,6 +228,18 @@ public:
    */
   virtual bool isMatPropRequested(const std::string & prop_name);
 
+  /**
+   * Record that a material property is consumed by an object that is evaluated outside of the
+   * Jacobian computation (AuxKernels, UserObjects, Materials, ...)
+   */
+  virtual void storeResidualMatPropRequest(const std::string & prop_name);
+
+  /**
+   * Find out if a material property has been requested by an object that is evaluated outside of
+   * the Jacobian computation
+   */
+  virtual bool isMatPropRequestedOutsideJacobian(const std::string & prop_name);
+
   /**
    * Will make sure that all dofs connected to elem_id are ghosted to this processor
    */
@@ -319,6 +333,9 @@ protected:
   std::map<unsigned int, std::multimap<std::string, std::string> > _map_boundary_material_props_check;
   ///@}
 
+  /// Material properties requested by objects that are not (only) evaluated in the Jacobian computation
+  std::set<std::string> _residual_material_props_requested;
+
   /// This is the set of MooseVariables that will actually get reinited by a call to reinit(elem)
   std::vector<std::set<MooseVariable *> > _active_elemental_moose_variables;
 
@@ -137,13 +137,14 @@ ThreadedElementLoopBase<RangeType>::operator () (const RangeType & range, bool b
 
     onElement(elem);
 
+    // The (side, boundary id) pairs of the element, sorted by side
+    ConstArrayView<std::pair<unsigned short int, BoundaryID> > bnd_sides = _mesh.elemBoundarySides(elem);
+    ConstArrayView<std::pair<unsigned short int, BoundaryID> >::const_iterator bnd_it = bnd_sides.begin();
+
     for (unsigned int side=0; side<elem->n_sides(); side++)
     {
-      std::vector<BoundaryID> boundary_ids = _mesh.boundaryIDs(elem, side);
-
-      if (boundary_ids.size() > 0)
-        for (std::vector<BoundaryID>::iterator it = boundary_ids.begin(); it != boundary_ids.end(); ++it)
-          onBoundary(elem, side, *it);
+      for (; bnd_it != bnd_sides.end() && bnd_it->first == side; ++bnd_it)
+        onBoundary(elem, side, bnd_it->second);
 
       if (elem->neighbor(side) != NULL)
         onInternalSide(elem, side);
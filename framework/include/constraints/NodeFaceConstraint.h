@@ -125,6 +125,13 @@ public:
   // Do the same for all the other public members
   SparseMatrix<Number> * _jacobian;
 
+  /// Whether the row of the slave dof in _jacobian was read into _slave_jacobian_cols and _slave_jacobian_values
+  bool _have_slave_jacobian_row;
+  /// Columns (sorted) of the nonzeros in the row of the slave dof in _jacobian
+  std::vector<dof_id_type> _slave_jacobian_cols;
+  /// Values of the nonzeros in the row of the slave dof in _jacobian
+  std::vector<Number> _slave_jacobian_values;
+
 protected:
   /// coupling interface:
 
@@ -149,6 +156,17 @@ protected:
 
   virtual VariableSecond & coupledMasterSecond(const std::string & var_name, unsigned int comp = 0){ return coupledNeighborSecond(var_name, comp); }
 
+  /**
+   * The entry of the Jacobian assembled before the constraints in the row of the slave dof and the column col.
+   * It is looked up in the row read by the system when there is one, otherwise read from _jacobian.
+   */
+  Real slaveJacobian(dof_id_type col);
+
+  /**
+   * Fill _connected_slave_jacobian for the current _connected_dof_indices
+   */
+  void getConnectedSlaveJacobian();
+
 
   /// Boundary ID for the slave surface
   unsigned int _slave;
@@ -198,8 +216,6 @@ protected:
   /// DOF map
   const DofMap & _dof_map;
 
-  std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
-
   /**
    * Whether or not the slave's residual should be overwritten.
    *
@@ -208,6 +224,9 @@ protected:
    */
   bool _overwrite_slave_residual;
 
+  /// The entries of the slave dof row of the assembled Jacobian for the columns in _connected_dof_indices
+  std::vector<Number> _connected_slave_jacobian;
+
 public:
   std::vector<dof_id_type> _connected_dof_indices;
 
@@ -134,13 +134,25 @@ protected:
   void addPoint(const Elem * elem, Point p, unsigned id=libMesh::invalid_uint);
 
   /**
-   * This is a highly inefficient way to add a point where this DiracKernel needs to be
-   * evaluated.
+   * Add a point where this DiracKernel needs to be evaluated.
    *
-   * This spawns a search for the element containing that point!
+   * This spawns a search for the element containing that point! The search starts
+   * from the element the point was cached in (see id) or the element of the previous
+   * point, only points that moved further than the neighbors of that element need
+   * the PointLocator.
    */
   const Elem * addPoint(Point p, unsigned id=libMesh::invalid_uint);
 
+  /**
+   * Add many points at once, optionally with one user-defined id per point. The points
+   * are located in Morton order, so that consecutive searches start from a nearby
+   * element.
+   * @param elems Filled with the element each point was found in (NULL if not local)
+   */
+  void addPointList(const std::vector<Point> & points,
+                    const std::vector<unsigned> & ids,
+                    std::vector<const Elem *> & elems);
+
   /**
    * Returns the user-assigned ID of the current Dirac point if it
    * exits, and libMesh::invalid_uint otherwise.  Can be used e.g. in
@@ -228,6 +240,10 @@ private:
   typedef std::map<const Elem*, std::vector<std::pair<Point, unsigned> > > reverse_cache_t;
   reverse_cache_t _reverse_point_cache;
 
+  /// The element the last point was located in, where the next search starts.
+  /// Reset by clearPoints() so it never survives a mesh change.
+  const Elem * _last_located_elem;
+
   /// This function is used internally when the Elem for a
   /// locally-cached point needs to be updated.  You must pass in a
   /// pointer to the old_elem whose data is to be updated, the
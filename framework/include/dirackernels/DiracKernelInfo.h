@@ -45,8 +45,9 @@ public:
    * Adds a point source
    * @param elem Pointer to the geometric element in which the point is located
    * @param p The (x,y,z) location of the Dirac point
+   * @return false if the point was already there
    */
-  void addPoint(const Elem * elem, Point p);
+  bool addPoint(const Elem * elem, Point p);
 
   /**
    * Remove all of the current points and elements.
@@ -56,7 +57,13 @@ public:
   /**
    * Return true if we have Point 'p' in Element 'elem'
    */
-  bool hasPoint(const Elem * elem, Point p);
+  bool hasPoint(const Elem * elem, Point p) const;
+
+  /**
+   * The points in Element 'elem', NULL if there are none. Does not modify the
+   * containers so it can be called from threads.
+   */
+  const std::vector<Point> * getPoints(const Elem * elem) const;
 
   /**
    * Returns a writeable reference to the _elements container.
@@ -76,9 +83,11 @@ public:
 
   /**
    * Used by client DiracKernel classes to determine the Elem in which
-   * the Point p resides.  Uses the PointLocator owned by this object.
+   * the Point p resides.  If a hint is given, it and its neighbors are
+   * checked first, the PointLocator owned by this object is only used
+   * when the point has moved further than that.
    */
-  const Elem * findPoint(Point p, const MooseMesh& mesh);
+  const Elem * findPoint(Point p, const MooseMesh& mesh, const Elem * hint = NULL);
 
 protected:
   /// The list of elements that need distributions.
@@ -87,6 +96,10 @@ protected:
   /// The list of physical xyz Points that need to be evaluated in each element.
   std::map<const Elem *, std::vector<Point> > _points;
 
+  /// The x coordinates of the points of each element mapped to their index in _points,
+  /// so hasPoint() only compares the points within TOLERANCE in x.
+  std::map<const Elem *, std::multimap<Real, unsigned int> > _point_index;
+
   /// The DiracKernelInfo object manages a PointLocator object which is used
   /// by all DiracKernels to find Points.  It needs to be centrally managed and it
   /// also needs to be rebuilt in FEProblem::meshChanged() to work with Mesh
@@ -127,6 +127,11 @@ public:
    */
   Real getSolutionChangeNorm();
 
+  /**
+   * Number of Picard iterations performed so far in the current time step (including the current one)
+   */
+  unsigned int numPicardIts() const { return _picard_it + 1; }
+
   /**
    * Pointer to the TimeStepper
    * @return Pointer to the time stepper for this Executioner
@@ -272,12 +277,48 @@ protected:
   Real _picard_rel_tol;
   Real _picard_abs_tol;
 
+  /**
+   * Picard acceleration (Aitken / Anderson) of the relaxed variables
+   */
+  /// Acceleration scheme applied between Picard iterations ("none", "aitken", "anderson")
+  MooseEnum _picard_acceleration;
+  /// Initial (Aitken) or mixing (Anderson) relaxation factor
+  Real _picard_relaxation_factor;
+  /// Number of previous iterates kept by Anderson acceleration
+  unsigned int _picard_anderson_depth;
+  /// Names of the variables that are relaxed
+  std::vector<VariableName> _picard_relaxed_var_names;
+  /// The system holding the relaxed variables
+  SystemBase * _picard_relaxed_sys;
+  /// Local dof indices of the relaxed variables (rebuilt every timestep)
+  std::vector<dof_id_type> _picard_relaxed_dofs;
+  /// Last relaxed iterate, last residual and last unrelaxed value (restricted to the relaxed dofs)
+  NumericVector<Number> * _picard_x;
+  NumericVector<Number> * _picard_f;
+  NumericVector<Number> * _picard_g;
+  /// Anderson history of residual and value differences (oldest first)
+  std::vector<NumericVector<Number> *> _picard_df;
+  std::vector<NumericVector<Number> *> _picard_dg;
+  /// Current Aitken relaxation factor
+  Real _picard_aitken_omega;
+
   ///should detailed diagnostic output be printed
   bool _verbose;
 
   Real _solution_change_norm;
 
   void setupTimeIntegrator();
+
+  /**
+   * Apply the selected Picard acceleration to the relaxed variables.  Called at the start
+   * of every Picard iteration after the TIMESTEP_BEGIN transfers have been executed.
+   */
+  void accelerateTransferredVariables();
+
+  /**
+   * Free the Picard acceleration history (called at the end of every timestep)
+   */
+  void clearPicardHistory();
 };
 
 #endif //TRANSIENTEXECUTIONER_H
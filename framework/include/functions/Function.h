@@ -22,6 +22,7 @@
 #include "UserObjectInterface.h"
 #include "Restartable.h"
 #include "MeshChangedInterface.h"
+#include "MooseArray.h"
 
 // libMesh
 #include "libmesh/vector_value.h"
@@ -67,6 +68,15 @@ public:
    */
   virtual Real value(Real t, const Point & p);
 
+  /**
+   * Evaluate the scalar function at all the points (e.g. the quadrature points of an element).
+   * By default this calls value() for every point, override it when the points can share work.
+   * \param t The time
+   * \param points The Points in space
+   * \param results Filled with the values of the function at the points
+   */
+  virtual void values(Real t, const MooseArray<Point> & points, std::vector<Real> & results);
+
   /**
    * Override this to evaluate the vector function at a point (t,x,y,z), by default
    * this returns a zero vector, you must override it.
@@ -39,6 +39,8 @@ protected:
   LinearInterpolation * _linear_interp;
   int _axis;
   bool _has_axis;
+  /// Interval of the last lookup in _linear_interp, functions are built per thread so this is per thread
+  unsigned int _interval_hint;
 private:
   const std::string _data_file_name;
   bool parseNextLineReals( std::ifstream & ifs, std::vector<Real> & myvec);
@@ -32,6 +32,12 @@ public:
    * This function will return a value based on the first input argument only.
    */
   virtual Real value(Real t, const Point & pt);
+
+  /**
+   * Looks the table up once for all points when the function only depends on time
+   */
+  virtual void values(Real t, const MooseArray<Point> & points, std::vector<Real> & results);
+
   /**
    * This function will return a value based on the first input argument only.
    */
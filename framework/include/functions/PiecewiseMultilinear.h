@@ -84,7 +84,7 @@ private:
    * @param lower_x Upon return will contain lower_x specified above
    * @param upper_x Upon return will contain upper_x specified above
    */
-  void getNeighborIndices(std::vector<Real> in_arr, Real x, unsigned int & lower_x, unsigned int & upper_x);
+  void getNeighborIndices(const std::vector<Real> & in_arr, Real x, unsigned int & lower_x, unsigned int & upper_x);
 };
 
 #endif //PIECEWISEMULTILINEAR_H
@@ -36,7 +36,6 @@ public:
                     std::vector<std::vector<FEBase *> > & fes,
                     FEType & fe_type,
                     NearestNodeLocator & nearest_node,
-                    std::map<unsigned int, std::vector<unsigned int> > & node_to_elem_map,
                     std::vector< unsigned int > & elem_list,
                     std::vector< unsigned short int > & side_list,
                     std::vector< short int > & id_list);
@@ -73,8 +72,6 @@ protected:
 
   NearestNodeLocator & _nearest_node;
 
-  std::map<unsigned int, std::vector<unsigned int> > & _node_to_elem_map;
-
   std::vector< unsigned int > & _elem_list;
   std::vector< unsigned short int > & _side_list;
   std::vector< short int > & _id_list;
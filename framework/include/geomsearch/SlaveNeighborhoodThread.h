@@ -27,7 +27,6 @@ class SlaveNeighborhoodThread
 public:
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<unsigned int> & trial_master_nodes,
-                          std::map<unsigned int, std::vector<unsigned int> > & node_to_elem_map,
                           const unsigned int patch_size);
 
 
@@ -54,9 +53,6 @@ protected:
   /// Nodes to search against
   const std::vector<unsigned int> & _trial_master_nodes;
 
-  /// Node to elem map
-  std::map<unsigned int, std::vector<unsigned int> > & _node_to_elem_map;
-
   /// The number of nodes to keep
   unsigned int _patch_size;
 };
@@ -31,10 +31,18 @@ public:
   BodyForce(const std::string & name, InputParameters parameters);
 
 protected:
+  /**
+   * Evaluates the function at all quadrature points of the element at once
+   */
+  virtual void precalculateResidual();
+
   virtual Real computeQpResidual();
 
   Real _value;
   Function & _function;
+
+  /// Values of the function at the quadrature points of the current element
+  std::vector<Real> _function_values;
 };
 
 #endif
@@ -22,6 +22,11 @@ class ErrorFractionMarker;
 template<>
 InputParameters validParams<ErrorFractionMarker>();
 
+/**
+ * Marks the elements with the largest errors for refinement and the ones with the smallest
+ * errors for coarsening.  Only the errors of the local elements are used; the cutoffs are
+ * found with parallel reductions.
+ */
 class ErrorFractionMarker : public IndicatorMarker
 {
 public:
@@ -33,14 +38,38 @@ public:
 protected:
   virtual MarkerValue computeElementMarker();
 
+  /**
+   * Parallel selection on the local errors by iteratively refining a histogram.
+   *
+   * With from_top the result is the smallest cutoff such that the elements with error >= cutoff
+   * hold at least target, otherwise the largest cutoff such that the elements with
+   * error < cutoff hold at most target. Elements are weighted by their error or by one.
+   * Elements with errors tied at the cutoff are all selected.
+   */
+  Real selectCutoff(Real target, bool weight_by_error, bool from_top);
+
+  /// How the cutoffs are chosen
+  enum Mode
+  {
+    ERROR_RANGE,
+    ERROR_FRACTION,
+    ELEMENT_COUNT
+  };
+
+  Mode _mode;
+
   Real _coarsen;
   Real _refine;
+  unsigned int _target_elements;
 
   Real _max;
   Real _min;
   Real _delta;
   Real _refine_cutoff;
   Real _coarsen_cutoff;
+
+  /// Errors of the active local elements
+  std::vector<Real> _local_errors;
 };
 
 #endif /* ERRORFRACTIONMARKER_H */
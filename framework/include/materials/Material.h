@@ -127,6 +127,14 @@ public:
   template<typename T>
   MaterialProperty<T> & declarePropertyOlder(const std::string & prop_name);
 
+  /**
+   * Declare a property that is only used by Jacobian computations (derivatives, tangent operators, ...).
+   * These properties are not updated during residual evaluations unless an object other than a
+   * Kernel, BC or Constraint requested them, see jacobianPropertiesNeeded().
+   */
+  template<typename T>
+  MaterialProperty<T> & declareJacobianProperty(const std::string & prop_name);
+
   virtual
   const std::set<std::string> &
   getRequestedItems() { return _depend_props; }
@@ -177,6 +185,18 @@ protected:
 
   std::set<std::string> _supplied_props;
 
+  /// Properties declared with declareJacobianProperty()
+  std::set<std::string> _jacobian_props;
+
+  /**
+   * Whether the properties declared with declareJacobianProperty() must be computed in the current
+   * evaluation: either one of them is read outside of the Jacobian computation (AuxKernels,
+   * UserObjects, other Materials, ...), or a Jacobian is being computed and at least one of them
+   * has been requested.  Materials should skip the computation of those properties when this
+   * returns false.
+   */
+  bool jacobianPropertiesNeeded();
+
   enum QP_Data_Type {
     CURR,
     PREV
@@ -220,6 +240,12 @@ private:
   void registerPropName(std::string prop_name, bool is_get, Prop_State state);
 
   bool _has_stateful_property;
+
+  /// Whether any of the Jacobian-only properties is requested (determined on first use)
+  bool _jacobian_props_checked;
+  bool _jacobian_props_requested;
+  /// Whether any of the Jacobian-only properties is read outside of the Jacobian computation
+  bool _jacobian_props_requested_outside_jacobian;
 };
 
 
@@ -275,5 +301,13 @@ Material::declarePropertyOlder(const std::string & prop_name)
   return _material_data.declarePropertyOlder<T>(prop_name);
 }
 
+template<typename T>
+MaterialProperty<T> &
+Material::declareJacobianProperty(const std::string & prop_name)
+{
+  _jacobian_props.insert(prop_name);
+  return declareProperty<T>(prop_name);
+}
+
 
 #endif //MATERIAL_H
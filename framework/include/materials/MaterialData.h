@@ -18,6 +18,7 @@
 #include "Moose.h"
 #include "MaterialProperty.h"
 #include "MaterialPropertyStorage.h"
+#include "ParallelUniqueId.h"
 
 //libMesh
 #include "libmesh/elem.h"
@@ -78,8 +79,8 @@ public:
 
   // material properties for given element (and possible side)
   void swap(const Elem & elem, unsigned int side = 0);
-  // Reinit material properties for given element (and possible side)
-  void reinit(std::vector<Material *> & mats);
+  // Reinit material properties for given element (and possible side), tid is the thread the materials belong to
+  void reinit(std::vector<Material *> & mats, THREAD_ID tid = 0);
   // material properties for given element (and possible side)
   void swapBack(const Elem & elem, unsigned int side = 0);
 
@@ -125,6 +125,9 @@ protected:
   /// Storage for the boundary ids created by BoundaryRestrictable
   std::vector<BoundaryID> _mi_boundary_ids;
 
+  /// True if the object is evaluated as part of the Jacobian computation (Kernels, BCs, Constraints, ...)
+  bool _mi_jacobian_consumer;
+
   /**
    * A helper method for checking material properties
    * This method was required to avoid a compiler problem with the templated
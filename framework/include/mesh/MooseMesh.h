@@ -22,6 +22,7 @@
 #include "MooseTypes.h"
 #include "Restartable.h"
 #include "MooseEnum.h"
+#include "CompressedConnectivity.h"
 
 // libMesh
 #include "libmesh/mesh.h"
@@ -114,6 +115,12 @@ public:
    */
   std::vector<BoundaryID> boundaryIDs(const Elem *const elem, const unsigned short int side) const;
 
+  /**
+   * Returns the (side, boundary ID) pairs of an active element sorted by side, cached by update()
+   * so that looping over the boundary sides of an element does not allocate.
+   */
+  ConstArrayView<std::pair<unsigned short int, BoundaryID> > elemBoundarySides(const Elem * elem) const;
+
   /**
    * Returns a const reference to a set of all user-specified
    * boundary IDs.
@@ -129,9 +136,16 @@ public:
   void buildNodeList();
   void buildBndElemList();
 
+  /**
+   * Returns the elements connected to a node. The connectivity is built on the first call
+   * after the mesh changed; thread safe.
+   */
+  ConstArrayView<dof_id_type> nodeToElems(dof_id_type node_id) const;
+
   /**
    * If not already created, creates a map from every node to all
-   * elements to which they are created.
+   * elements to which they are created. Kept for applications, prefer nodeToElems()
+   * which does not duplicate the connectivity in a map.
    */
   std::map<unsigned int, std::vector<unsigned int> > & nodeToElemMap();
 
@@ -379,7 +393,7 @@ public:
   /**
    * Return list of blocks to which the given node belongs.
    */
-  std::set<SubdomainID> & getNodeBlockIds(const Node & node);
+  ConstArrayView<SubdomainID> getNodeBlockIds(const Node & node) const;
 
   /**
    * Return a writable reference to a vector of node IDs that belong
@@ -473,6 +487,15 @@ public:
    */
   void buildPeriodicNodeMap(std::multimap<unsigned int, unsigned int> & periodic_node_map, unsigned int var_number, PeriodicBoundaries *pbs) const;
 
+  /**
+   * Same as above, the (node id, paired node id) pairs are returned sorted and unique in a flat array.
+   * The nodes of every periodic boundary are moved to the paired boundary and matched to its nodes
+   * through a spatial binning, so the cost grows as n log(n) with the number of boundary nodes.
+   * The candidate nodes of the paired boundaries are taken from the boundary node list, which must
+   * have been built from the side list beforehand (see prepare() and buildNodeListFromSideList()).
+   */
+  void buildPeriodicNodeMap(std::vector<std::pair<dof_id_type, dof_id_type> > & periodic_node_pairs, unsigned int var_number, PeriodicBoundaries *pbs) const;
+
   /**
    * This routine builds a datastructure of node ids organized by periodic boundary ids
    */
@@ -581,7 +604,7 @@ public:
    * @param subdomain_id The subdomain ID you want to get the boundary ids for.
    * @return All boundary IDs connected to elements in the give
    */
-  const std::set<unsigned int> & getSubdomainBoundaryIds(unsigned int subdomain_id);
+  ConstArrayView<BoundaryID> getSubdomainBoundaryIds(SubdomainID subdomain_id) const;
 
   /**
    * Returns true if the requested node is in the list of boundary
@@ -733,7 +756,14 @@ protected:
   ConstBndNodeRange * _bnd_node_range;
   ConstBndElemRange * _bnd_elem_range;
 
-  /// A map of all of the current nodes to the elements that they are connected to.
+  /// The elements connected to every node, built on demand by nodeToElems()
+  mutable CompressedConnectivity<dof_id_type> _node_to_elem;
+  mutable bool _node_to_elem_built;
+
+  /// The elements connected to the quadrature nodes, whose ids are past the end of _node_to_elem
+  std::map<dof_id_type, std::vector<dof_id_type> > _quadrature_node_to_elem;
+
+  /// The connectivity of _node_to_elem as a map, only built when nodeToElemMap() is called
   std::map<unsigned int, std::vector<unsigned int> > _node_to_elem_map;
   bool _node_to_elem_map_built;
 
@@ -759,8 +789,14 @@ protected:
   std::vector<BndNode *> _bnd_nodes;
   typedef std::vector<BndNode *>::iterator             bnd_node_iterator_imp;
   typedef std::vector<BndNode *>::const_iterator const_bnd_node_iterator_imp;
-  /// Map of sets of node IDs in each boundary
-  std::map<boundary_id_type, std::set<unsigned int> > _bnd_node_ids;
+  /// Boundary IDs of every node
+  CompressedConnectivity<BoundaryID> _node_bnd_ids;
+
+  /// Boundary IDs of the nodes past the end of _node_bnd_ids (quadrature nodes)
+  std::map<dof_id_type, std::vector<BoundaryID> > _extra_node_bnd_ids;
+
+  /// The (side, boundary ID) pairs of every active element
+  CompressedConnectivity<std::pair<unsigned short int, BoundaryID> > _elem_bnd_sides;
 
   /// array of boundary elems
   std::vector<BndElement *> _bnd_elems;
@@ -773,8 +809,8 @@ protected:
   std::map<unsigned int, std::map<unsigned int, std::map<unsigned int, Node *> > > _elem_to_side_to_qp_to_quadrature_nodes;
   std::vector<BndNode> _extra_bnd_nodes;
 
-  /// list of nodes that belongs to a specified block (domain)
-  std::map<unsigned int, std::set<SubdomainID> > _block_node_list;
+  /// The blocks (domains) every node belongs to
+  CompressedConnectivity<SubdomainID> _node_block_ids;
 
   /// list of nodes that belongs to a specified nodeset: indexing [nodeset_id] -> [array of node ids]
   std::map<boundary_id_type, std::vector<unsigned int> > _node_set_nodes;
@@ -810,6 +846,9 @@ protected:
   void freeBndNodes();
   void freeBndElems();
 
+  /// Record a boundary of a node past the end of _node_bnd_ids
+  void addExtraNodeBoundaryId(dof_id_type node_id, BoundaryID bnd_id);
+
 private:
   /**
    * A map of vectors indicating which dimensions are periodic in a regular orthogonal mesh for
@@ -904,8 +943,8 @@ private:
   /// Holds mappings for volume to volume and parent side to child side
   std::map<std::pair<int, ElemType>, std::vector<std::pair<unsigned int, QpMap> > > _elem_type_to_coarsening_map;
 
-  /// Holds a map from subomdain ids to the boundary ids that are attached to it
-  std::map<unsigned int, std::set<unsigned int> > _subdomain_boundary_ids;
+  /// The boundary ids attached to every subdomain
+  CompressedConnectivity<BoundaryID> _subdomain_boundary_ids;
 
   /// Whether or not this Mesh is allowed to read a recovery file
   bool _allow_recovery;
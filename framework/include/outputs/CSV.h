@@ -66,6 +66,11 @@ public:
    */
   void initialSetup();
 
+  /**
+   * Writes the object timing (--object-timing) to <file_base>_object_timing.csv
+   */
+  virtual void outputObjectTiming();
+
 private:
 
   /// Flag for aligning data in .csv file
@@ -60,6 +60,11 @@ public:
    */
   virtual void timestepSetup();
 
+  /**
+   * Prints the object timing table (--object-timing)
+   */
+  virtual void outputObjectTiming();
+
   /**
    * Adds a outputting of nonlinear/linear residual printing to the base class output() method
    *
@@ -24,6 +24,8 @@
 
 // Forward declarations
 class Exodus;
+namespace libMesh { class ExodusII_IO_Helper; }
+class ExodusWriteJob;
 
 template<>
 InputParameters validParams<Exodus>();
@@ -118,6 +120,23 @@ protected:
 
 private:
 
+  /**
+   * Stages the data of the current output step and queues it for the background writer
+   * (async = true). The gathers are collective, so every processor stages the data but only
+   * processor 0 writes it.
+   */
+  void outputAsync();
+
+  /**
+   * Copies the requested nodal variables out of the gathered solution into the job
+   */
+  void stageNodalVariables(ExodusWriteJob & job);
+
+  /**
+   * Queues the closing of the file written in the background, if any
+   */
+  void closeAsyncFile();
+
   /**
    * A helper function for 'initializing' the ExodusII output file, see the comments for the _initialized
    * member variable.
@@ -130,6 +149,21 @@ private:
 
   /// Flag indicating MOOSE is recovering via --recover command-line option
   bool _recovering;
+
+  /// True when the files are written by the background thread
+  bool _async;
+
+  /// Number of output steps that may wait for the background thread
+  unsigned int _async_queue_size;
+
+  /// True when the current file is written by the background thread (not when appending on recover)
+  bool _async_file;
+
+  /// True once the first step of the current background file was queued
+  bool _async_file_created;
+
+  /// File access of the background writer (processor 0 only), only used on the writer thread
+  ExodusII_IO_Helper * _async_helper;
 };
 
 #endif /* EXODUS_H */
@@ -296,6 +296,13 @@ protected:
    */
   virtual void timestepSetup();
 
+  /**
+   * Writes the execution time of the individual objects (--object-timing) at the end of the run.
+   * The timings are reduced over the processors, so this is called on every processor by
+   * OutputWarehouse::outputObjectTiming once the executioner is done.
+   */
+  virtual void outputObjectTiming();
+
   /**
    * This method is called initially by the output() method prior to any of the variable output methods.
    * Hence, the child class should use this method to prepare for outputing data. For example, the Exodus
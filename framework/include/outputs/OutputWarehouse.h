@@ -84,6 +84,11 @@ public:
    */
   void outputFinal();
 
+  /**
+   * Calls the outputObjectTiming method for each output object, must be called on every processor
+   */
+  void outputObjectTiming();
+
   /**
    * Calls the meshChanged method for every output object
    */
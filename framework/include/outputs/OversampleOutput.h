@@ -22,7 +22,6 @@
 #include "libmesh/equation_systems.h"
 #include "libmesh/equation_systems.h"
 #include "libmesh/numeric_vector.h"
-#include "libmesh/mesh_function.h"
 
 // Forward declerations
 class OversampleOutput;
@@ -115,11 +114,33 @@ private:
   void cloneMesh();
 
   /**
-   * A vector of pointers to the mesh functions
-   * This is only populated when the oversample() function is called, it must
-   * be cleaned up by the destructor.
+   * Locates the local nodes of the oversampled mesh in the source mesh and stores the
+   * source dofs and shape function values needed to evaluate every variable there.
+   * Called the first time update() runs and whenever the source mesh changes.
+   */
+  void buildOversampleMaps();
+
+  /**
+   * Everything needed to evaluate the variables of one system at the local nodes of the
+   * oversampled mesh: value(dest_dofs[i]) = sum_j phi[j] * u(source_dofs[j]) for
+   * offsets[i] <= j < offsets[i+1].
    */
-  std::vector<std::vector<MeshFunction *> > _mesh_functions;
+  struct OversampleMap
+  {
+    std::vector<dof_id_type> dest_dofs;
+    std::vector<unsigned int> offsets;
+    std::vector<dof_id_type> source_dofs;
+    std::vector<Real> phi;
+
+    /// Source dofs owned by other processors
+    std::vector<numeric_index_type> send_list;
+  };
+
+  /// The evaluation data of each system
+  std::vector<OversampleMap> _oversample_maps;
+
+  /// Whether _oversample_maps are up to date
+  bool _oversample_maps_built;
 
   /// Flag for enabling oversampling
   bool _oversample;
@@ -133,11 +154,9 @@ private:
   /// When oversampling, the output is shift by this amount
   Point _position;
 
-  /// Oversample solution vector
-  /* Each of the MeshFunctions keeps a reference to this vector, the vector is updated for the current system
-   * and variable before the MeshFunction is applied. This allows for the same MeshFunction object to be
-   * re-used, unless the mesh has changed due to adaptivity */
-  AutoPtr<NumericVector<Number> > _serialized_solution;
+  /// Ghosted copies of the source solutions holding the local values and the send_list of each
+  /// system, so only the values that are needed are communicated (NULL for systems without variables)
+  std::vector<NumericVector<Number> *> _ghosted_solutions;
 };
 
 #endif // OVERSAMPLEOUTPUT_H
@@ -0,0 +1,49 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTPERFORMANCEDATA_H
+#define OBJECTPERFORMANCEDATA_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class ObjectPerformanceData;
+
+template<>
+InputParameters validParams<ObjectPerformanceData>();
+
+/**
+ * Reports the call count or execution time of a kernel, material, BC, aux kernel or user object,
+ * summed over the threads and processors. Requires the --object-timing command line option,
+ * without it the value is zero.
+ */
+class ObjectPerformanceData : public GeneralPostprocessor
+{
+public:
+  ObjectPerformanceData(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+
+  virtual Real getValue();
+
+protected:
+  MooseEnum _column;
+
+  std::string _object;
+
+  std::string _object_base;
+};
+
+#endif // OBJECTPERFORMANCEDATA_H
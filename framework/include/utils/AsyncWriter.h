@@ -0,0 +1,97 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ASYNCWRITER_H
+#define ASYNCWRITER_H
+
+#include "libmesh/libmesh_config.h"
+
+#include <deque>
+#include <string>
+
+#ifdef LIBMESH_HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+/**
+ * Runs file writing jobs in order on a single background thread, so the solve can go on
+ * while the data of a previous step is written.
+ *
+ * There is one writer per process (Moose::async_writer): the I/O libraries (netCDF) are not
+ * thread safe, so every object writing through them from the background has to share the
+ * thread, and objects reading or writing synchronously have to flush() first (which also makes
+ * sure a file written in the background is complete before it is read back). Without pthreads
+ * the jobs run as soon as they are queued.
+ */
+class AsyncWriter
+{
+public:
+  /**
+   * A unit of work for the writer thread. It must own copies of all the data it writes.
+   */
+  class Job
+  {
+  public:
+    virtual ~Job() {}
+    virtual void run() = 0;
+  };
+
+  AsyncWriter();
+
+  /**
+   * Waits for the queued jobs and stops the thread
+   */
+  ~AsyncWriter();
+
+  /**
+   * Queue a job, the writer takes ownership of it. Blocks while max_pending jobs (including
+   * the one being run) are waiting, which bounds the memory held by the staged data.
+   */
+  void enqueue(Job * job, unsigned int max_pending);
+
+  /**
+   * Wait until all queued jobs are done. A failure of a job is reported here (or by the next
+   * enqueue) with mooseError.
+   */
+  void flush();
+
+private:
+  /// Run a job, recording the first failure
+  void runJob(Job * job);
+
+  /// Report a recorded failure, called on the main thread only
+  void checkError();
+
+#ifdef LIBMESH_HAVE_PTHREAD
+  static void * threadEntry(void * writer);
+  void threadLoop();
+
+  pthread_t _thread;
+  pthread_mutex_t _mutex;
+  /// Signaled when a job is queued or the writer shuts down
+  pthread_cond_t _job_queued;
+  /// Signaled when a job is done
+  pthread_cond_t _job_done;
+  bool _running;
+  bool _shutdown;
+#endif
+
+  /// Queued jobs, the front one is being run
+  std::deque<Job *> _jobs;
+
+  /// Message of the first failed job
+  std::string _error;
+};
+
+#endif // ASYNCWRITER_H
@@ -0,0 +1,143 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPRESSEDCONNECTIVITY_H
+#define COMPRESSEDCONNECTIVITY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/**
+ * Read only view of a contiguous range of values owned by someone else. It is
+ * invalidated when the owner is rebuilt.
+ */
+template <typename T>
+class ConstArrayView
+{
+public:
+  typedef const T * const_iterator;
+
+  ConstArrayView() : _begin(NULL), _end(NULL) {}
+  ConstArrayView(const T * begin, const T * end) : _begin(begin), _end(end) {}
+
+  const_iterator begin() const { return _begin; }
+  const_iterator end() const { return _end; }
+
+  unsigned int size() const { return _end - _begin; }
+  bool empty() const { return _begin == _end; }
+
+  const T & operator[](unsigned int i) const { return _begin[i]; }
+
+  /**
+   * Whether the (sorted) range contains value
+   */
+  bool contains(const T & value) const { return std::binary_search(_begin, _end, value); }
+
+private:
+  const T * _begin;
+  const T * _end;
+};
+
+/**
+ * Compressed row storage of a one-to-many relation from a dense range of integer rows
+ * (node ids, element ids, subdomain ids) to values. The values of every row are sorted
+ * and unique.
+ */
+template <typename T>
+class CompressedConnectivity
+{
+public:
+  CompressedConnectivity() : _offsets(1, 0) {}
+
+  /**
+   * Build the relation from the (rows[i], values[i]) pairs; every row must be less than n_rows.
+   * Rows are filled with a counting pass, so the build is linear in the number of pairs apart
+   * from sorting the (short) individual rows.
+   */
+  void build(unsigned int n_rows, const std::vector<unsigned int> & rows, const std::vector<T> & values);
+
+  void clear();
+
+  /// Number of rows, rows past the end are empty
+  unsigned int nRows() const { return _offsets.size() - 1; }
+
+  /**
+   * The values of row, an empty view for rows past the end
+   */
+  ConstArrayView<T> operator()(unsigned int row) const
+  {
+    if (row + 1 >= _offsets.size())
+      return ConstArrayView<T>();
+
+    const T * data = _values.empty() ? NULL : &_values[0];
+    return ConstArrayView<T>(data + _offsets[row], data + _offsets[row + 1]);
+  }
+
+  /// Bytes held by the arrays
+  std::size_t memorySize() const { return _offsets.capacity() * sizeof(unsigned int) + _values.capacity() * sizeof(T); }
+
+private:
+  /// Start of every row in _values, plus the end of the last one
+  std::vector<unsigned int> _offsets;
+  std::vector<T> _values;
+};
+
+template <typename T>
+void
+CompressedConnectivity<T>::build(unsigned int n_rows, const std::vector<unsigned int> & rows, const std::vector<T> & values)
+{
+  // Count the entries of every row and turn the counts into offsets
+  std::vector<unsigned int> offsets(n_rows + 1, 0);
+  for (unsigned int i = 0; i < rows.size(); ++i)
+    offsets[rows[i] + 1]++;
+  for (unsigned int row = 0; row < n_rows; ++row)
+    offsets[row + 1] += offsets[row];
+
+  std::vector<T> row_values(values.size());
+  std::vector<unsigned int> position(offsets.begin(), offsets.end() - 1);
+  for (unsigned int i = 0; i < rows.size(); ++i)
+    row_values[position[rows[i]]++] = values[i];
+
+  // Sort every row and drop its duplicates, compacting the array in place
+  unsigned int n_values = 0;
+  for (unsigned int row = 0; row < n_rows; ++row)
+  {
+    const unsigned int row_begin = offsets[row];
+    typename std::vector<T>::iterator begin = row_values.begin() + row_begin;
+    typename std::vector<T>::iterator end = row_values.begin() + offsets[row + 1];
+    std::sort(begin, end);
+    end = std::unique(begin, end);
+
+    offsets[row] = n_values;
+    if (n_values != row_begin)
+      std::copy(begin, end, row_values.begin() + n_values);
+    n_values += end - begin;
+  }
+  offsets[n_rows] = n_values;
+  row_values.resize(n_values);
+
+  _offsets.swap(offsets);
+  _values.swap(row_values);
+}
+
+template <typename T>
+void
+CompressedConnectivity<T>::clear()
+{
+  std::vector<unsigned int>(1, 0).swap(_offsets);
+  std::vector<T>().swap(_values);
+}
+
+#endif // COMPRESSEDCONNECTIVITY_H
@@ -36,7 +36,9 @@ public:
                       const std::vector<double> & Y);
   LinearInterpolation() :
     _x(std::vector<double>()),
-    _y(std::vector<double>()) {}
+    _y(std::vector<double>()),
+    _uniform(false),
+    _inv_dx(0) {}
 
   virtual ~LinearInterpolation()
     {}
@@ -59,12 +61,30 @@ public:
    */
   double sample(double x) const;
 
+  /**
+   * Same as above, hint is the interval of a previous lookup. It is checked (together with the
+   * next interval) before searching, and updated to the interval of x, which makes monotone
+   * sequences of lookups O(1). Every caller (thread) should keep its own hint.
+   */
+  double sample(double x, unsigned int & hint) const;
+
+  /**
+   * Samples all the abscissas in x into values, using the interval of the previous point as
+   * the hint for the next one
+   */
+  void sample(const std::vector<double> & x, std::vector<double> & values) const;
+
   /**
    * This function will take an independent variable input and will return the derivative of the dependent variable
    * with respect to the independent variable based on the generated fit
    */
   double sampleDerivative(double x) const;
 
+  /**
+   * Same as above, using and updating the interval hint (see sample())
+   */
+  double sampleDerivative(double x, unsigned int & hint) const;
+
   /**
    * This function will dump GNUPLOT input files that can be run to show the data points and
    * function fits
@@ -86,9 +106,21 @@ public:
 
 private:
 
+  /**
+   * Index i of the interval with _x[i] <= x < _x[i+1], x must lie in [_x[0], _x.back()).
+   * Uniform grids compute it directly, others check the hint and then do a binary search.
+   */
+  unsigned int findInterval(double x, unsigned int hint) const;
+
   std::vector<double> _x;
   std::vector<double> _y;
 
+  /// Whether the abscissas are equally spaced
+  bool _uniform;
+
+  /// Inverse of the spacing of a uniform grid
+  double _inv_dx;
+
   static int _file_number;
 };
 
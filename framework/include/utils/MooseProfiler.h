@@ -0,0 +1,209 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MOOSEPROFILER_H
+#define MOOSEPROFILER_H
+
+#include "libmesh/libmesh_common.h"
+#include "libmesh/threads.h"
+
+#include <sys/time.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Push a profiler section, replacement for Moose::perf_log.push(label, header). The section is
+ * registered the first time the call site is reached, after that only its integer id is used.
+ */
+#define MOOSE_PROFILE_PUSH(label, header)                                                       \
+  do                                                                                            \
+  {                                                                                             \
+    static const unsigned int _moose_profile_section = Moose::profiler.registerSection(label, header); \
+    Moose::profiler.push(_moose_profile_section);                                               \
+  } while (0)
+
+/**
+ * Pop a profiler section, replacement for Moose::perf_log.pop(label, header)
+ */
+#define MOOSE_PROFILE_POP(label, header)                                                        \
+  do                                                                                            \
+  {                                                                                             \
+    static const unsigned int _moose_profile_section = Moose::profiler.registerSection(label, header); \
+    Moose::profiler.pop(_moose_profile_section);                                                \
+  } while (0)
+
+/**
+ * Hierarchical profiler working on registered sections.
+ *
+ * Sections are registered once and afterwards identified by an integer, so pushing and popping
+ * costs a clock read and a short search among the children of the current node. Every thread
+ * records into its own call tree, where a node is a section together with the chain of sections
+ * that were active when it was entered.
+ */
+class MooseProfiler
+{
+public:
+  /// Timing data of a node of the call tree, or summed over several nodes
+  struct Data
+  {
+    Data() : n_calls(0), self_time(0.), total_time(0.) {}
+
+    unsigned long n_calls;
+    /// Time spent in the section itself
+    double self_time;
+    /// Time spent in the section and the sections entered from it
+    double total_time;
+  };
+
+  MooseProfiler();
+
+  /**
+   * Sizes the per-thread call trees, must be called before threads other than 0 push sections.
+   */
+  void setNumThreads(unsigned int n_threads);
+
+  /**
+   * Returns the id of the section (label, header), registering it on the first call. Thread safe.
+   */
+  unsigned int registerSection(const std::string & label, const std::string & header);
+
+  /**
+   * Enter/leave a section on the given thread. The push and the matching pop must run on the same
+   * OS thread; a ParallelUniqueId is only reserved while a loop body runs, so threaded loops are
+   * timed with a section around Threads::parallel_reduce on the master thread instead.
+   */
+  inline void push(unsigned int section, unsigned int tid = 0);
+  inline void pop(unsigned int section, unsigned int tid = 0);
+
+  /**
+   * Data of the node reached by following the section labels in path from the top level,
+   * summed over the threads.
+   */
+  Data getNodeData(const std::vector<std::string> & path) const;
+
+  /**
+   * Data of a section summed over every place in the call tree it was entered from.
+   */
+  Data getSectionData(const std::string & label) const;
+
+  /**
+   * Time spent in the top level sections of the master thread
+   */
+  double getActiveTime() const;
+
+  /**
+   * Wall time since the profiler was created
+   */
+  double getElapsedTime() const;
+
+  /**
+   * The call tree summed over the threads, formatted as a table
+   */
+  std::string getPerfInfo() const;
+
+private:
+  struct Node
+  {
+    Node(unsigned int section_in, unsigned int parent_in) :
+        section(section_in), parent(parent_in), n_calls(0), total_time(0.), children_time(0.) {}
+
+    unsigned int section;
+    unsigned int parent;
+    /// (section, node) pairs of the children
+    std::vector<std::pair<unsigned int, unsigned int> > children;
+    unsigned long n_calls;
+    double total_time;
+    double children_time;
+  };
+
+  struct ThreadData
+  {
+    std::vector<Node> nodes;
+    /// (node, start time) of the sections currently entered
+    std::vector<std::pair<unsigned int, double> > stack;
+  };
+
+  static double now();
+
+  /// Index of the child of parent for section, created if it does not exist yet
+  inline unsigned int child(std::vector<Node> & nodes, unsigned int parent, unsigned int section);
+  static unsigned int addChild(std::vector<Node> & nodes, unsigned int parent, unsigned int section);
+
+  /// Reports a pop that does not match the innermost pushed section, in every build mode
+  void mismatchedPop(unsigned int section, unsigned int tid) const;
+
+  /// The call trees of all threads merged into one
+  std::vector<Node> mergedTree() const;
+
+  void printNode(std::ostream & out, const std::vector<Node> & nodes, unsigned int node, unsigned int depth, double active_time) const;
+
+  /// Registered (label, header) pairs and their ids
+  std::vector<std::pair<std::string, std::string> > _sections;
+  std::map<std::pair<std::string, std::string>, unsigned int> _section_ids;
+  libMesh::Threads::spin_mutex _registration_mutex;
+
+  std::vector<ThreadData> _thread_data;
+
+  double _start_time;
+};
+
+inline double
+MooseProfiler::now()
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + 1.e-6 * tv.tv_usec;
+}
+
+inline unsigned int
+MooseProfiler::child(std::vector<Node> & nodes, unsigned int parent, unsigned int section)
+{
+  const std::vector<std::pair<unsigned int, unsigned int> > & children = nodes[parent].children;
+  for (unsigned int i = 0; i < children.size(); ++i)
+    if (children[i].first == section)
+      return children[i].second;
+
+  return addChild(nodes, parent, section);
+}
+
+inline void
+MooseProfiler::push(unsigned int section, unsigned int tid)
+{
+  ThreadData & data = _thread_data[tid];
+  const unsigned int parent = data.stack.empty() ? 0 : data.stack.back().first;
+  const unsigned int node = child(data.nodes, parent, section);
+  data.stack.push_back(std::make_pair(node, now()));
+}
+
+inline void
+MooseProfiler::pop(unsigned int section, unsigned int tid)
+{
+  ThreadData & data = _thread_data[tid];
+  if (data.stack.empty() || data.nodes[data.stack.back().first].section != section)
+  {
+    mismatchedPop(section, tid);
+    return;
+  }
+
+  const double elapsed = now() - data.stack.back().second;
+  Node & node = data.nodes[data.stack.back().first];
+  node.n_calls++;
+  node.total_time += elapsed;
+  data.nodes[node.parent].children_time += elapsed;
+  data.stack.pop_back();
+}
+
+#endif // MOOSEPROFILER_H
@@ -22,6 +22,8 @@
 #include "libmesh/libmesh_config.h"
 #include LIBMESH_INCLUDE_UNORDERED_MAP
 
+#include <stdint.h>
+
 /**
  * This class encapsulates a useful, consistent, cross-platform random number generator
  * with multiple utilities.
@@ -36,6 +38,11 @@
  *    generators can be saved and restored for all streams by using the "saveState" and
  *    "restoreState" methods.  Finally, this class uses a fast hash map so that indexes
  *    for the generators are not required to be contiguous.
+ *
+ * 3. COUNTER-BASED INTERFACE:
+ *    The static "philox" method is a stateless generator: its output only depends on a key and
+ *    a counter, so any number of independent, reproducible streams can be drawn without storing
+ *    a generator state per stream.
  */
 class MooseRandom
 {
@@ -87,6 +94,47 @@ public:
     return mt_lrand();
   }
 
+  /**
+   * Counter-based generator (Philox4x32-10, Salmon et al. "Parallel random numbers: as easy as 1, 2, 3").
+   * @param key      two words selecting the family of streams (e.g. the seed)
+   * @param counter  four words selecting the block within the family (e.g. entity id and call index)
+   * @param result   four random 32-bit numbers
+   */
+  static inline void philox(const uint32_t key[2], const uint32_t counter[4], uint32_t result[4])
+  {
+    uint32_t k0 = key[0], k1 = key[1];
+    uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+
+    for (unsigned int round = 0; round < 10; ++round)
+    {
+      const uint64_t p0 = static_cast<uint64_t>(0xD2511F53) * c0;
+      const uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57) * c2;
+
+      c0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+      c1 = static_cast<uint32_t>(p1);
+      c2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+      c3 = static_cast<uint32_t>(p0);
+
+      // Weyl sequence key schedule
+      k0 += 0x9E3779B9;
+      k1 += 0xBB67AE85;
+    }
+
+    result[0] = c0;
+    result[1] = c1;
+    result[2] = c2;
+    result[3] = c3;
+  }
+
+  /**
+   * Combines two random 32-bit numbers into a double
+   * @return      a random number in the range [0,1) with 53-bit precision
+   */
+  static inline double toDouble(uint32_t a, uint32_t b)
+  {
+    return ((a >> 5) * 67108864.0 + (b >> 6)) * (1.0 / 9007199254740992.0);
+  }
+
   /**
    * The methoed seeds one of the independent random number generators
    * @param i     the index of the generator
@@ -0,0 +1,127 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTPROFILER_H
+#define OBJECTPROFILER_H
+
+#include "Moose.h"
+#include "ParallelUniqueId.h"
+
+// libMesh includes
+#include "libmesh/parallel.h"
+
+#include <sys/time.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Execution time and call count of the individual objects (kernels, materials, BCs,
+ * aux kernels, user objects) of a MooseApp, enabled with --object-timing.
+ *
+ * Objects register themselves on construction when the profiler is enabled; when it is
+ * disabled they keep an invalid id and ObjectTimer does nothing but compare it. Every thread
+ * accumulates into its own array, the threads and processors are only summed for reporting.
+ */
+class ObjectProfiler
+{
+public:
+  /// Accumulated timing of an object on a thread
+  struct Data
+  {
+    Data() : n_calls(0), time(0.) {}
+
+    unsigned long n_calls;
+    Real time;
+  };
+
+  /// Timing of an object summed over the threads and processors
+  struct Entry
+  {
+    /// The registered base of the object (Kernel, Material, AuxKernel, ...)
+    std::string base;
+    std::string name;
+    unsigned long n_calls;
+    /// Time summed over the threads and processors
+    Real time;
+    /// Largest time spent by a single processor
+    Real max_time;
+  };
+
+  ObjectProfiler();
+
+  /**
+   * Turn on the timing for objects constructed from now on
+   */
+  void enable(unsigned int n_threads);
+
+  bool enabled() const { return _enabled; }
+
+  /**
+   * Returns the id for the object with the given registered base and name, objects sharing both
+   * (the per-thread copies) share an id. Returns libMesh::invalid_uint when the profiler is disabled.
+   */
+  unsigned int registerObject(const std::string & base, const std::string & name);
+
+  /**
+   * Data the object with the given id accumulates into on thread tid
+   */
+  Data & data(unsigned int id, THREAD_ID tid) { return _thread_data[tid][id]; }
+
+  /**
+   * Timing of the named object on this processor, summed over the threads. With an empty base
+   * the objects of every base sharing the name are summed.
+   */
+  Data getLocalData(const std::string & name, const std::string & base = "") const;
+
+  /**
+   * Timing of every object that was called, summed over the processors and sorted by
+   * decreasing time. Must be called on all processors of comm.
+   */
+  std::vector<Entry> getReducedData(const Parallel::Communicator & comm) const;
+
+  /**
+   * The reduced data formatted as a table
+   */
+  std::string getPerfInfo(const Parallel::Communicator & comm) const;
+
+  /**
+   * Write the reduced data to a CSV file (on processor 0)
+   */
+  void writeCSV(const std::string & file_name, const Parallel::Communicator & comm) const;
+
+  static inline double now();
+
+private:
+  bool _enabled;
+
+  /// Registered (base, name) of the objects, indexed by id
+  std::vector<std::pair<std::string, std::string> > _keys;
+  std::map<std::pair<std::string, std::string>, unsigned int> _ids;
+
+  /// Timing data indexed by thread and object id
+  std::vector<std::vector<Data> > _thread_data;
+};
+
+inline double
+ObjectProfiler::now()
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + 1.e-6 * tv.tv_usec;
+}
+
+#endif // OBJECTPROFILER_H
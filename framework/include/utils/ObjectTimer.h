@@ -0,0 +1,55 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTTIMER_H
+#define OBJECTTIMER_H
+
+#include "MooseObject.h"
+#include "MooseApp.h"
+#include "ObjectProfiler.h"
+
+/**
+ * Adds the time until it goes out of scope to the ObjectProfiler entry of an object.
+ * When object timing is disabled this only checks the id of the object.
+ */
+class ObjectTimer
+{
+public:
+  ObjectTimer(MooseObject & object, THREAD_ID tid) :
+      _data(NULL),
+      _start(0.)
+  {
+    const unsigned int id = object.objectProfilerId();
+    if (id != libMesh::invalid_uint)
+    {
+      _data = &object.getMooseApp().getObjectProfiler().data(id, tid);
+      _start = ObjectProfiler::now();
+    }
+  }
+
+  ~ObjectTimer()
+  {
+    if (_data)
+    {
+      _data->n_calls++;
+      _data->time += ObjectProfiler::now() - _start;
+    }
+  }
+
+private:
+  ObjectProfiler::Data * _data;
+  double _start;
+};
+
+#endif // OBJECTTIMER_H
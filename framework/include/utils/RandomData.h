@@ -19,6 +19,8 @@
 #include "Moose.h"          // For ExecFlaType
 #include "MooseRandom.h"
 
+#include "libmesh/point.h"
+
 #include "libmesh/libmesh_config.h"
 #include LIBMESH_INCLUDE_UNORDERED_MAP
 
@@ -49,9 +51,37 @@ public:
    */
   unsigned int getSeed(dof_id_type id);
 
+  /**
+   * Whether the numbers come from the stateless counter-based generator instead of one
+   * Mersenne Twister per elem/node.
+   */
+  bool isCounterBased() const { return _counter_based; }
+
+  /**
+   * Counter that changes every time the streams are updated or reset, the call indices passed to
+   * counterRandl() and counterRand() restart with it.
+   */
+  unsigned int generation() const { return _generation; }
+
+  /**
+   * Counter-based streams: the stream key of the elem/node at point p (the node itself or the
+   * element centroid).  Ids are renumbered per partitioning on a ParallelMesh, positions are not.
+   */
+  static uint64_t counterKey(const Point & p);
+
+  /**
+   * Counter-based streams: returns random number call_index (32-bit or Real in [0,1)) of the stream
+   * with the given key
+   */
+  uint32_t counterRandl(uint64_t key, unsigned int call_index) const;
+  Real counterRand(uint64_t key, unsigned int call_index) const;
+
 private:
   void updateGenerators();
 
+  /// Counter-based streams: the random block for (seed, timestep, epoch, key, call_index)
+  void counterBlock(uint64_t key, unsigned int call_index, uint32_t result[4]) const;
+
   FEProblem & _rd_problem;
   MooseMesh & _rd_mesh;
 
@@ -63,6 +93,13 @@ private:
   unsigned int _current_master_seed;
   unsigned int _new_seed;
 
+  bool _counter_based;
+  /// Counter-based streams: time step of the current seed
+  unsigned int _step;
+  /// Counter-based streams: number of updates since the last reset
+  unsigned int _epoch;
+  unsigned int _generation;
+
   LIBMESH_BEST_UNORDERED_MAP<dof_id_type, unsigned int> _seeds;
 };
 
@@ -67,11 +67,18 @@ public:
    **************************************************/
   unsigned int getMasterSeed() const { return _master_seed; }
   bool isNodal() const { return _is_nodal; }
+  bool isCounterBased() const { return _counter_based; }
   ExecFlagType getResetOnTime() const { return _reset_on; }
 
   void setRandomDataPointer(RandomData *random_data);
 
 private:
+  /**
+   * Counter-based streams: index of the next number drawn for elem/node id. It restarts whenever
+   * a different elem/node is visited or the streams are updated, _counter_key is refreshed with it.
+   */
+  unsigned int nextCallIndex(dof_id_type id);
+
   RandomData *_random_data;
   MooseRandom *_generator;
 
@@ -82,6 +89,12 @@ private:
   bool _is_nodal;
   ExecFlagType _reset_on;
 
+  bool _counter_based;
+  dof_id_type _last_id;
+  uint64_t _counter_key;
+  unsigned int _last_generation;
+  unsigned int _call_index;
+
   const Node * & _curr_node;
   const Elem * & _curr_element;
 
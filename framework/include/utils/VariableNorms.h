@@ -0,0 +1,79 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef VARIABLENORMS_H
+#define VARIABLENORMS_H
+
+#include "Moose.h"
+#include "CompressedConnectivity.h"
+
+// libMesh includes
+#include "libmesh/numeric_vector.h"
+
+class SystemBase;
+
+/**
+ * Discrete l2 norms of a vector of a system restricted to each of its variables, and to each
+ * variable on each mesh block. All of them are computed in a single pass over the local entries
+ * of the vector and a single reduction, where System::calculate_norm() takes a pass and a
+ * reduction per variable.
+ *
+ * The variable and the blocks of every local dof are found once and kept until the mesh changes.
+ * A dof on a node is counted in every block having an element connected to the node.
+ */
+class VariableNorms
+{
+public:
+  VariableNorms(SystemBase & sys);
+
+  /**
+   * Compute all the norms of vec, a vector of the system (collective)
+   */
+  void compute(const NumericVector<Number> & vec);
+
+  /**
+   * Drop the dofs of the old mesh, they are found again by the next compute()
+   */
+  void meshChanged() { _layout_built = false; }
+
+  /// The norm of the part of the vector belonging to variable var
+  Real norm(unsigned int var) const { return _norms[var]; }
+
+  /// The norm of the part of the vector belonging to variable var on block, 0 for unknown blocks
+  Real blockNorm(unsigned int var, SubdomainID block) const;
+
+protected:
+  /**
+   * Find the variable and blocks of every local dof
+   */
+  void buildLayout();
+
+  SystemBase & _sys;
+
+  /// Whether _dof_var and _dof_blocks belong to the current mesh
+  bool _layout_built;
+  /// The first local dof
+  dof_id_type _first_local_dof;
+  /// The variable of every local dof, invalid_uint for dofs of none
+  std::vector<unsigned int> _dof_var;
+  /// Positions in _blocks of the blocks of every local dof
+  CompressedConnectivity<unsigned int> _dof_blocks;
+  /// The blocks of the mesh (sorted)
+  std::vector<SubdomainID> _blocks;
+
+  /// The norms of each variable, followed by the norms of each (variable, block) pair
+  std::vector<Real> _norms;
+};
+
+#endif // VARIABLENORMS_H
@@ -0,0 +1,95 @@
+# Bubble A moves along the strip while bubble B appears at t = 2, at t = 4 A runs into B.
+# With track_bubble_ids A keeps id 1 while it moves, B gets the new id 2 and the merged
+# bubble takes over id 2 since it holds most of B's previous nodes.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 2
+  xmax = 1
+  ymax = 0.1
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[AuxVariables]
+  [./c]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+  [./bubble_map]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Functions]
+  [./bubbles_func]
+    type = ParsedFunction
+    value = 'if(abs(x-0.05-0.15*t)<0.12,1,0)+if(t>1.5&abs(x-0.85)<0.12,1,0)'
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./c]
+    type = FunctionAux
+    variable = c
+    function = bubbles_func
+    execute_on = timestep_begin
+  [../]
+  [./mapper]
+    type = NodalFloodCountAux
+    variable = bubble_map
+    execute_on = timestep
+    bubble_object = bubbles
+  [../]
+[]
+
+[Postprocessors]
+  [./bubbles]
+    type = NodalFloodCount
+    variable = c
+    threshold = 0.5
+    track_bubble_ids = true
+    execute_on = timestep
+  [../]
+  [./left]
+    type = PointValue
+    variable = bubble_map
+    point = '0.3 0.05 0'
+  [../]
+  [./middle]
+    type = PointValue
+    variable = bubble_map
+    point = '0.6 0.05 0'
+  [../]
+  [./right]
+    type = PointValue
+    variable = bubble_map
+    point = '0.85 0.05 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 4
+[]
+
+[Outputs]
+  output_initial = false
+  csv = true
+[]
@@ -33,6 +33,7 @@ public:
 
   virtual void initialSetup();
   virtual void timestepSetup();
+  virtual void meshChanged();
   void updateReferenceResidual();
   virtual MooseNonlinearConvergenceReason checkNonlinearConvergence(std::string &msg,
                                                                     const int it,
@@ -61,6 +62,8 @@ protected:
   int _accept_iters;
   std::vector<Real> _refResid;
   std::vector<Real> _resid;
+  /// Norms of the aux variables providing the reference residuals
+  VariableNorms _ref_resid_norms;
 };
 
 #endif /* REFERENCERESIDUALPROBLEM_H */
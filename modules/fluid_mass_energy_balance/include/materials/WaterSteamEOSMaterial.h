@@ -0,0 +1,77 @@
+/****************************************************************/
+/*             DO NOT MODIFY OR REMOVE THIS HEADER              */
+/*          FALCON - Fracturing And Liquid CONvection           */
+/*                                                              */
+/*       (c) pending 2012 Battelle Energy Alliance, LLC         */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef WATERSTEAMEOSMATERIAL_H
+#define WATERSTEAMEOSMATERIAL_H
+
+#include "Material.h"
+#include "WaterSteamEOS.h"
+
+//Forward Declarations
+class WaterSteamEOSMaterial;
+
+template<>
+InputParameters validParams<WaterSteamEOSMaterial>();
+
+/**
+ * Fluid properties of the pressure & enthalpy formulation (density, temperature, phase enthalpies and their
+ * derivatives) used by the mass and energy kernels, evaluated by a WaterSteamEOS one element at a time.
+ */
+class WaterSteamEOSMaterial : public Material
+{
+public:
+  WaterSteamEOSMaterial(const std::string & name, InputParameters parameters);
+
+protected:
+  virtual void computeProperties();
+
+  const WaterSteamEOS & _water_steam_properties;
+
+  VariableValue & _pressure;
+  VariableValue & _enthalpy;
+  VariableValue & _pressure_old;
+  VariableValue & _enthalpy_old;
+  /// Initial guess of the temperature iterations of the correlations
+  VariableValue & _temperature;
+
+  /// Properties of the current and of the old solution, reused from element to element
+  WaterSteamEOS::PropertiesPH _props;
+  WaterSteamEOS::PropertiesPH _props_old;
+
+  MaterialProperty<Real> & _density;
+  MaterialProperty<Real> & _time_old_density;
+  MaterialProperty<Real> & _ddensitydp_H;
+  MaterialProperty<Real> & _ddensitydH_P;
+
+  MaterialProperty<Real> & _temp;
+  MaterialProperty<Real> & _time_old_temp;
+  MaterialProperty<Real> & _dTdP_H;
+  MaterialProperty<Real> & _dTdH_P;
+
+  MaterialProperty<Real> & _sat_water;
+  MaterialProperty<Real> & _dsat_waterdH_P;
+  MaterialProperty<Real> & _density_water;
+  MaterialProperty<Real> & _density_steam;
+  MaterialProperty<Real> & _viscosity_water;
+  MaterialProperty<Real> & _viscosity_steam;
+
+  MaterialProperty<Real> & _enthalpy_water;
+  MaterialProperty<Real> & _enthalpy_steam;
+  MaterialProperty<Real> & _denthalpy_waterdP_H;
+  MaterialProperty<Real> & _denthalpy_waterdH_P;
+  MaterialProperty<Real> & _denthalpy_steamdP_H;
+  MaterialProperty<Real> & _denthalpy_steamdH_P;
+};
+
+#endif //WATERSTEAMEOSMATERIAL_H
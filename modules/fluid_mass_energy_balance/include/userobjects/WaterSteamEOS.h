@@ -16,6 +16,7 @@
 #define WATERSTEAMEOS_H
 
 #include "GeneralUserObject.h"
+#include "MooseVariableBase.h"
 
 class WaterSteamEOS;
 
@@ -29,6 +30,37 @@ public:
 
     virtual ~WaterSteamEOS();
 
+    /**
+     * Properties and derivatives for a batch of points (typically all the quadrature points of
+     * an element), see waterAndSteamEquationOfStatePropertiesWithDerivativesPH()
+     */
+    struct PropertiesPH
+    {
+      void resize(unsigned int n_points);
+
+      std::vector<Real> temp;
+      std::vector<Real> sat_fraction;
+      std::vector<Real> dens;
+      std::vector<Real> dens_water;
+      std::vector<Real> dens_steam;
+      std::vector<Real> enth_water;
+      std::vector<Real> enth_steam;
+      std::vector<Real> visc_water;
+      std::vector<Real> visc_steam;
+      std::vector<Real> d_enth_water_d_press;
+      std::vector<Real> d_enth_steam_d_press;
+      std::vector<Real> d_dens_d_press;
+      std::vector<Real> d_temp_d_press;
+      std::vector<Real> d_enth_water_d_enth;
+      std::vector<Real> d_enth_steam_d_enth;
+      std::vector<Real> d_dens_d_enth;
+      std::vector<Real> d_temp_d_enth;
+      std::vector<Real> d_sat_fraction_d_enth;
+    };
+
+    /// Builds (or loads) the property table when the tabulated mode is enabled
+    virtual void initialSetup();
+
     virtual void initialize(){}
 
     virtual void execute(){}
@@ -49,6 +81,100 @@ public:
     Real waterAndSteamEquationOfStatePropertiesPH (Real enth_in, Real press_in, Real temp_in, Real& phase, Real& temp_out, Real& temp_sat, Real& sat_fraction_out, Real& dens_out, Real& dens_water_out, Real& dens_steam_out, Real& enth_water_out, Real& enth_steam_out, Real& visc_water_out, Real& visc_steam_out, Real& del_press, Real& del_enth) const;
 
     Real waterAndSteamEquationOfStatePropertiesWithDerivativesPH (Real enth_in, Real press_in, Real temp_in, Real& temp_out, Real& sat_fraction_out, Real& dens_out, Real& dens_water_out, Real& dens_steam_out, Real& enth_water_out, Real& enth_steam_out, Real& visc_water_out, Real& visc_steam_out, Real& d_enth_water_d_press, Real& d_enth_steam_d_press, Real& d_dens_d_press, Real& d_temp_d_press, Real& d_enth_water_d_enth, Real& d_enth_steam_d_enth, Real& d_dens_d_enth, Real& d_temp_d_enth, Real& d_sat_fraction_d_enth) const;
+
+    /// Batched version of the above, evaluating all points at once (temp_in holds the initial temperature guesses)
+    void waterAndSteamEquationOfStatePropertiesWithDerivativesPH (const VariableValue & enth_in, const VariableValue & press_in, const VariableValue & temp_in, PropertiesPH & props) const;
+
+protected:
+    /// Properties of the saturation line stored in the one dimensional (pressure) table
+    enum SaturationProperty
+    {
+      SAT_TEMP,
+      SAT_ENTH_WATER,
+      SAT_ENTH_STEAM,
+      SAT_DENS_WATER,
+      SAT_DENS_STEAM,
+      SAT_VISC_WATER,
+      SAT_VISC_STEAM,
+      N_SAT_PROPERTIES
+    };
+
+    /// Properties stored in the two dimensional (pressure, normalized enthalpy) single phase tables
+    enum SinglePhaseProperty
+    {
+      SP_TEMP,
+      SP_DENS,
+      SP_VISC,
+      N_SP_PROPERTIES
+    };
+
+    /// Single phase regions of the table: compressed water below the saturation line, steam above it
+    enum TableRegion
+    {
+      WATER_REGION,
+      STEAM_REGION
+    };
+
+    /**
+     * Table lookup replacing waterAndSteamEquationOfStatePropertiesWithDerivativesPH(). Returns false
+     * if (enth_in, press_in) lies outside of the table, in which case nothing is computed.
+     */
+    bool tableLookupPH (Real enth_in, Real press_in, Real& temp_out, Real& sat_fraction_out, Real& dens_out, Real& dens_water_out, Real& dens_steam_out, Real& enth_water_out, Real& enth_steam_out, Real& visc_water_out, Real& visc_steam_out, Real& d_enth_water_d_press, Real& d_enth_steam_d_press, Real& d_dens_d_press, Real& d_temp_d_press, Real& d_enth_water_d_enth, Real& d_enth_steam_d_enth, Real& d_dens_d_enth, Real& d_temp_d_enth, Real& d_sat_fraction_d_enth) const;
+
+    /// Cubic Hermite interpolation of the saturation properties and their pressure derivatives
+    void saturationLookup (Real press_in, Real * values, Real * d_values_d_press) const;
+
+    /// Bicubic Hermite interpolation of a single phase region, derivatives are taken at constant normalized enthalpy xi
+    void singlePhaseLookup (unsigned int region, Real press_in, Real xi, Real * values, Real * d_values_d_press, Real * d_values_d_xi) const;
+
+    /// Evaluates the analytic correlations at all nodes of the table
+    void buildTable();
+
+    /// Computes the nodal slopes used by the Hermite interpolation from the nodal values
+    void computeTableSlopes();
+
+    /// Reads the nodal values from the cache file, returns false if it is missing or was built for another range
+    bool readTable(const std::string & file_name);
+
+    void writeTable(const std::string & file_name) const;
+
+    /// Compares the table against the analytic correlations at the cell centers
+    void verifyTable() const;
+
+    /// Offset of the (value, slope_p, slope_xi, cross slope) entries of a node in _region_table
+    unsigned int regionIndex(unsigned int i, unsigned int j, unsigned int prop) const { return ((i * _table_enth_points + j) * N_SP_PROPERTIES + prop) * 4; }
+
+    /// First node of the three point stencil used for the slope at node i of an axis with n nodes
+    static unsigned int stencilStart(unsigned int i, unsigned int n);
+
+    /// Slope (per node spacing) at node offset (0, 1 or 2) of the parabola through the nodal values f0, f1 and f2
+    static Real nodalSlope(unsigned int offset, Real f0, Real f1, Real f2);
+
+    /// Cubic Hermite basis functions (h00, h10, h01, h11) and their derivatives at t in [0, 1]
+    static void hermiteBasis(Real t, Real * basis, Real * d_basis);
+
+    /// Whether the tabulated mode is enabled
+    const bool _tabulated;
+
+    /// Pressure and enthalpy range covered by the table
+    Real _table_press_min;
+    Real _table_press_max;
+    Real _table_enth_min;
+    Real _table_enth_max;
+
+    /// Number of table nodes along the pressure and the normalized enthalpy axes
+    const unsigned int _table_press_points;
+    const unsigned int _table_enth_points;
+
+    /// Node spacing along the pressure and the normalized enthalpy axes
+    Real _table_dpress;
+    Real _table_dxi;
+
+    /// Saturation line: (value, slope) pairs for each pressure node and SaturationProperty
+    std::vector<Real> _sat_table;
+
+    /// Single phase regions: (value, slope_p, slope_xi, cross slope) for each node and SinglePhaseProperty
+    std::vector<Real> _region_table[2];
 };
 
 #endif /* WATERSTEAMEOS_H */
@@ -0,0 +1,116 @@
+# Two phase state (50 bar, 2 MJ/kg) held by constant auxiliary variables on a unit square, the
+# integrals of the material properties over the element are the properties themselves
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./pressure]
+    initial_condition = 5e6
+  [../]
+  [./enthalpy]
+    initial_condition = 2e6
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[UserObjects]
+  [./water_steam_properties]
+    type = WaterSteamEOS
+  [../]
+[]
+
+[Materials]
+  [./fluid]
+    type = WaterSteamEOSMaterial
+    block = 0
+    pressure = pressure
+    enthalpy = enthalpy
+    water_steam_properties = water_steam_properties
+  [../]
+[]
+
+[Postprocessors]
+  [./dens]
+    type = ElementIntegralMaterialProperty
+    mat_prop = density
+  [../]
+  [./d_dens_d_p]
+    type = ElementIntegralMaterialProperty
+    mat_prop = ddensitydp_H
+  [../]
+  [./d_dens_d_h]
+    type = ElementIntegralMaterialProperty
+    mat_prop = ddensitydH_P
+  [../]
+  [./temp]
+    type = ElementIntegralMaterialProperty
+    mat_prop = material_temperature
+  [../]
+  [./d_temp_d_p]
+    type = ElementIntegralMaterialProperty
+    mat_prop = dTdP_H
+  [../]
+  [./sat_water]
+    type = ElementIntegralMaterialProperty
+    mat_prop = saturation_water
+  [../]
+  [./d_sat_water_d_h]
+    type = ElementIntegralMaterialProperty
+    mat_prop = dsaturation_waterdH_P
+  [../]
+  [./enth_water]
+    type = ElementIntegralMaterialProperty
+    mat_prop = enthalpy_water
+  [../]
+  [./d_enth_water_d_p]
+    type = ElementIntegralMaterialProperty
+    mat_prop = denthalpy_waterdP_H
+  [../]
+  [./enth_steam]
+    type = ElementIntegralMaterialProperty
+    mat_prop = enthalpy_steam
+  [../]
+  [./d_enth_steam_d_p]
+    type = ElementIntegralMaterialProperty
+    mat_prop = denthalpy_steamdP_H
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  csv = true
+[]
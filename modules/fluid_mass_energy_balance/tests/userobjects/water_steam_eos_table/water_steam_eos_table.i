@@ -0,0 +1,55 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[UserObjects]
+  [./water_steam_properties]
+    type = WaterSteamEOS
+    tabulated = true
+    table_pressure_range = '1e6 15e6'
+    table_enthalpy_range = '2e5 3.2e6'
+    table_pressure_points = 60
+    table_enthalpy_points = 60
+    verify_table = true
+    table_tolerance = 1e-3
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  console = true
+[]
@@ -17,6 +17,10 @@ public:
 
   virtual ~GapHeatTransfer(){}
 
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  virtual void computeJacobianBlock(unsigned int jvar);
+
 protected:
 /**
  * Generic gap heat transfer model, with h_gap =  h_conduction + h_contact + h_radiation
@@ -32,6 +36,16 @@ protected:
 
   virtual void computeGapValues();
 
+  /**
+   * Calls computeGapValues() for every qp of the current side and stores the results, the
+   * computeQp* methods then pick them up with getGapValues() instead of repeating the
+   * penetration lookups for every test and shape function.
+   */
+  void precomputeGapValues();
+
+  /// Sets the gap values of the current qp from the ones stored by precomputeGapValues()
+  void getGapValues();
+
   bool _quadrature;
 
   NumericVector<Number> * _slave_flux;
@@ -64,6 +78,15 @@ protected:
 
   PenetrationLocator * _penetration_locator;
   const bool _warnings;
+
+  /// The gap values of every qp of the current side
+  std::vector<Real> _qp_gap_temp;
+  std::vector<Real> _qp_gap_distance;
+  std::vector<Real> _qp_edge_multiplier;
+  std::vector<bool> _qp_has_info;
+
+  /// The contributions of the current side to the slave flux, added to _slave_flux once per side
+  DenseVector<Number> _local_slave_flux;
 };
 
 #endif //GAPHEATTRANSFER_H
@@ -21,6 +21,12 @@ public:
 
   virtual ~INSMass(){}
 
+  /**
+   * Maps jvar to a velocity component once per element.  The pressure and any other
+   * variable add nothing to this residual and are skipped.
+   */
+  virtual void computeOffDiagJacobian(unsigned int jvar);
+
 protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
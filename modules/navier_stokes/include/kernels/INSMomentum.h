@@ -21,6 +21,12 @@ public:
 
   virtual ~INSMomentum(){}
 
+  /**
+   * Maps jvar to a velocity component or the pressure once per element and takes the
+   * per-qp factors out of the (i, j) loops.  Other variables are skipped.
+   */
+  virtual void computeOffDiagJacobian(unsigned int jvar);
+
 protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
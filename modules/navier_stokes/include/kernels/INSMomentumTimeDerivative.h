@@ -21,6 +21,12 @@ public:
 
   virtual ~INSMomentumTimeDerivative(){}
 
+  /**
+   * The time derivative has no off-diagonal terms: only the diagonal block is computed,
+   * every other block is dropped without looking anything up.
+   */
+  virtual void computeOffDiagJacobian(unsigned int jvar);
+
 protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
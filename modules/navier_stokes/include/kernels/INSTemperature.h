@@ -20,6 +20,12 @@ public:
 
   virtual ~INSTemperature(){}
 
+  /**
+   * Maps jvar to a velocity component once per element.  Only the convective term
+   * couples to other variables, so the pressure and the rest are skipped.
+   */
+  virtual void computeOffDiagJacobian(unsigned int jvar);
+
 protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
@@ -51,6 +51,11 @@ protected:
   // Energy equation inviscid flux matrices
   MaterialProperty<std::vector<std::vector<RealTensorValue> > >& _calE;
 
+  // SUPG residual fluxes and Jacobian matrices of all the equations, with the
+  // tau values included.  See NavierStokesMaterial for the layout.
+  MaterialProperty<std::vector<RealVectorValue> >& _supg_residual_fluxes;
+  MaterialProperty<std::vector<RealTensorValue> >& _supg_jacobian_matrices;
+
   // "Old" (from previous timestep) coupled variable values.
 //  VariableValue& _rho_old;
 //  VariableValue& _rho_u_old;
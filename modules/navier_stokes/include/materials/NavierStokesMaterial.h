@@ -116,6 +116,17 @@ protected:
   // residual at each quadrature point.
   MaterialProperty<std::vector<Real> > & _strong_residuals;
 
+  // The SUPG residual of equation "eq" (0=mass, 1-3=momentum, 4=energy) at a
+  // qp is _supg_residual_fluxes[qp][eq] * grad(phi_i).  The tau values are
+  // included.
+  MaterialProperty<std::vector<RealVectorValue> > & _supg_residual_fluxes;
+
+  // The SUPG Jacobian of equation "eq" wrt variable "m" (canonical numbering)
+  // is grad(phi_i) * (_supg_jacobian_matrices[qp][5*eq + m] * grad(phi_j)),
+  // apart from the time derivative part of the mass equation.  The tau values
+  // are included.  Only computed while computing the Jacobian.
+  MaterialProperty<std::vector<RealTensorValue> > & _supg_jacobian_matrices;
+
 private:
   // To be called from computeProperties() function to compute _hsupg
   void compute_h_supg(unsigned qp);
@@ -125,6 +136,10 @@ private:
 
   // To be called from computeProperties() function to compute the strong residual of each equation.
   void compute_strong_residuals(unsigned qp);
+
+  // To be called from computeProperties() function to compute the SUPG residual
+  // fluxes and Jacobian matrices shared by the SUPG kernels.
+  void compute_supg_terms(unsigned qp);
 };
 
 #endif //NAVIERSTOKESMATERIAL_H
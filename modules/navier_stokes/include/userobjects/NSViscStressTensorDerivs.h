@@ -75,11 +75,10 @@ Real NSViscStressTensorDerivs<T>::dtau(unsigned k, unsigned ell, unsigned m)
     _data._grad_rho_v[_data._qp](1) +
     _data._grad_rho_w[_data._qp](2);
 
-  // This makes a copy...but the resulting code is cleaner
-  std::vector<RealVectorValue> gradU(3);
-  gradU[0] = _data._grad_rho_u[_data._qp];
-  gradU[1] = _data._grad_rho_v[_data._qp];
-  gradU[2] = _data._grad_rho_w[_data._qp];
+  // This is called for every (i,j) pair, so avoid allocating storage here
+  const RealVectorValue * gradU[3] = { &_data._grad_rho_u[_data._qp],
+                                       &_data._grad_rho_v[_data._qp],
+                                       &_data._grad_rho_w[_data._qp] };
 
   // So we can refer to gradients without repeated indexing.
   const RealVectorValue& grad_phij = _data._grad_phi[_data._j][_data._qp];
@@ -90,7 +89,7 @@ Real NSViscStressTensorDerivs<T>::dtau(unsigned k, unsigned ell, unsigned m)
   case 0: // density
   {
     Real term1 =  2./rho2 * (U(k)*grad_rho(ell) + U(ell)*grad_rho(k)) * phij;
-    Real term2 = -1./rho*( (gradU[k](ell) + gradU[ell](k))*phij + (U(k)*grad_phij(ell) + U(ell)*grad_phij(k)) );
+    Real term2 = -1./rho*( ((*gradU[k])(ell) + (*gradU[ell])(k))*phij + (U(k)*grad_phij(ell) + U(ell)*grad_phij(k)) );
 
     // Kronecker delta terms
     Real term3 = 0.;
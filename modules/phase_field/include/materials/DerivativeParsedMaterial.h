@@ -31,6 +31,7 @@ protected:
 private:
   void functionsDerivative();
   void functionsOptimize();
+  void buildEvaluationList();
 
   /// Shorthand for an autodiff function parser object.
   typedef FunctionParserADBase<Real> ADFunction;
@@ -51,8 +52,15 @@ private:
   std::vector<MaterialProperty<Real> *> _mat_props;
   unsigned int _nmat_props;
 
-  /// Array to stage the parameters passed to the functions when calling Eval.
-  Real * _func_params;
+  /// Stage for the parameters passed to the functions when calling Eval (one block per quadrature point).
+  std::vector<Real> _func_params;
+
+  /// Functions that are evaluated and the material properties they are stored in
+  std::vector<ADFunction *> _eval_funcs;
+  std::vector<MaterialProperty<Real> *> _eval_props;
+
+  /// Requested material properties of vanishing derivatives
+  std::vector<MaterialProperty<Real> *> _zero_props;
 
   /// Tolerance values for all arguments (to protect from log(0)).
   std::vector<Real> _tol;
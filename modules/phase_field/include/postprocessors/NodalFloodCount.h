@@ -21,7 +21,7 @@
 #include "ZeroInterface.h"
 #include "InfixIterator.h"
 
-#include <list>
+#include <map>
 #include <vector>
 #include <set>
 #include <iterator>
@@ -43,6 +43,9 @@ InputParameters validParams<NodalFloodCount>();
  *
  * Note:  When inspecting multiple variables, those variables must not have regions of interest
  *        that overlap or they will not be correctly colored.
+ *
+ * The partial bubbles found by each processor are joined through the labels of the ghosted (and
+ * periodic) nodes only, which are sent to the owners of those nodes.
  */
 class NodalFloodCount :
   public GeneralPostprocessor,
@@ -56,7 +59,7 @@ public:
 
   virtual void initialize();
   virtual void execute();
-//  virtual void threadJoin(const UserObject & y);
+  virtual void meshChanged();
   virtual void finalize();
   virtual Real getValue();
 
@@ -68,18 +71,6 @@ public:
   virtual std::vector<std::vector<std::pair<unsigned int, unsigned int> > > getElementalValues(unsigned int /*elem_id*/) const;
 
 protected:
-  class BubbleData
-  {
-  public:
-    BubbleData(std::set<unsigned int> & nodes, unsigned int var_idx) :
-        _nodes(nodes),
-        _var_idx(var_idx)
-    {}
-
-    std::set<unsigned int> _nodes;
-    unsigned int _var_idx;
-  };
-
   /**
    * This method is used to populate any of the data structures used for storing field data (nodal or elemental).
    * It is called at the end of finalize and can make use of any of the data structures created during
@@ -89,29 +80,47 @@ protected:
 
   /**
    * This method will "mark" all nodes on neighboring elements that
-   * are above the supplied threshold
+   * are above the supplied threshold.  The flooding is done iteratively
+   * with an explicit stack over the precomputed node adjacency.
    */
   void flood(const Node *node, int current_idx, unsigned int live_region);
 
   /**
-   * These routines packs/unpack the _bubble_map data into a structure suitable for parallel
-   * communication operations. See the comments in these routines for the exact
-   * data structure layout.
+   * Build the compressed (CSR) node-to-node adjacency of the semilocal nodes used while flooding.
+   * Two nodes are neighbors if they share an element edge.
    */
-  void pack(std::vector<unsigned int> &, bool merge_periodic_info=true) const;
-  void unpack(const std::vector<unsigned int> &);
+  void buildNodeAdjacency();
 
   /**
-   * This routine merges the data in _bubble_sets from separate threads/processes to resolve
-   * any bubbles that were counted as unique by multiple processors.
+   * This routine joins the regions flooded by the different processors to resolve any bubbles that were
+   * counted as unique by multiple processors.  The owner of each ghosted or periodic node receives the
+   * labels given to it by the other processors, the resulting (small) label graph is gathered and
+   * resolved with a union-find structure.  Fills _label_ids, _label_var_idx and _bubble_ids.
    */
   void mergeSets();
 
   /**
-   * This routine adds the periodic node information to our data structure prior to packing the data
-   * this makes those periodic neighbors appear much like ghosted nodes in a multiprocessor setting
+   * Appends a [ <node id> <map> <var_idx> <label> ] tuple to the data sent to a processor
+   */
+  static void appendLabelTuple(std::vector<unsigned int> & data, unsigned int node_id, unsigned int map_num, unsigned int var_idx, unsigned int label);
+
+  /**
+   * Sends send_data[pid] to every processor pid, only processors that are sent data get a message.
+   * The received data is appended to received.
+   */
+  void exchangeLabelTuples(std::vector<std::vector<unsigned int> > & send_data, std::vector<unsigned int> & received) const;
+
+  /**
+   * Give every merged bubble (root label) the id of the bubble of the previous step it overlaps most,
+   * or a new id.
+   */
+  void trackBubbleIds(std::vector<unsigned int> & parent, unsigned int first_label, const std::vector<unsigned int> & label_info,
+                      const std::vector<std::vector<std::pair<unsigned int, unsigned int> > > & roots, std::vector<unsigned int> & root_ids);
+
+  /**
+   * Union-find helper: returns the representative of the set containing "i" (with path compression)
    */
-  unsigned int appendPeriodicNeighborNodes(std::set<unsigned int> & data) const;
+  static unsigned int findRoot(std::vector<unsigned int> & parent, unsigned int i);
 
   /**
    * This routine updates the _region_offsets variable which is useful for quickly determining
@@ -120,7 +129,7 @@ protected:
   void updateRegionOffsets();
 
   /**
-   * This routine uses the bubble_sets data structure to calculate the volume of each stored bubble.
+   * This routine uses the bubble maps to calculate the volume of each bubble.
    */
   void calculateBubbleVolumes();
 
@@ -131,26 +140,6 @@ protected:
   template<class T>
   void writeCSVFile(const std::string file_name, const std::vector<T> data);
 
-  /**
-   * This method detects whether two sets intersect without building a result set.  It exits as soon as
-   * any intersection is detected.
-   */
-  template<class InputIterator>
-  inline bool setsIntersect(InputIterator first1, InputIterator last1, InputIterator first2, InputIterator last2) const
-    {
-      while (first1 != last1 && first2 != last2)
-      {
-        if (*first1 == *first2)
-          return true;
-
-        if (*first1 < *first2)
-          ++first1;
-        else if (*first1 > *first2)
-          ++first2;
-      }
-      return false;
-    }
-
   // Attempt to make a lower bound computation of memory consumed by this object
   virtual unsigned long calculateUsage() const;
 
@@ -195,15 +184,18 @@ protected:
   /// This variable is used to inidicate whether the maps will continue unique region information or just the variable numbers owning those regions
   const bool _var_index_mode;
 
+  /// Whether bubbles keep their ids from one step to the next
+  const bool _track_bubble_ids;
+
   /// Convienence variable holding the size of all the datastructures size by the number of maps
   const unsigned int _maps_size;
 
   /**
-   * This variable keeps track of which nodes have been visited during execution.  We don't use the _bubble_map
-   * for this since we don't want to explicitly store data for all the unmarked nodes in a serialized datastructures.
-   * This keeps our overhead down since this variable never needs to be communicated.
+   * This variable keeps track of which nodes have been visited during execution (a flat bitmap indexed by node id
+   * per variable).  We don't use the _bubble_map for this since we don't want to explicitly store data for all the
+   * unmarked nodes in a serialized datastructures.  This variable never needs to be communicated.
    */
-  std::vector<std::map<unsigned int, bool> > _nodes_visited;
+  std::vector<std::vector<bool> > _nodes_visited;
 
   /**
    * The bubble maps contain the raw flooded node information and eventually the unique grain numbers.  We have a vector
@@ -218,11 +210,18 @@ protected:
    */
   std::vector<std::map<unsigned int, int> > _var_index_maps;
 
-  /// The data structure used to marshall the data between processes and/or threads
-  std::vector<unsigned int> _packed_data;
+  /**
+   * Compressed node adjacency: the semilocal neighbors of node "n" are
+   * _node_neighbors[_node_neighbor_offsets[n]] ... _node_neighbors[_node_neighbor_offsets[n+1]-1]
+   */
+  std::vector<unsigned int> _node_neighbor_offsets;
+  std::vector<unsigned int> _node_neighbors;
+
+  /// Whether the node adjacency needs to be rebuilt (the mesh changed)
+  bool _rebuild_adjacency;
 
-  /// The data structure used to find neighboring elements give a node ID
-  std::vector< std::vector< const Elem * > > _nodes_to_elem_map;
+  /// Work stack used while flooding
+  std::vector<unsigned int> _flood_stack;
 
   /// This data structure is used to keep track of which bubbles are owned by which variables (index).
   std::vector<unsigned int> _region_to_var_idx;
@@ -230,15 +229,27 @@ protected:
   /// This data structure holds the offset value for unique bubble ids (updated inside of finalize)
   std::vector<unsigned int> _region_offsets;
 
-  /**
-   * The data structure used to join partial bubbles between processes and/or threads.  We may have a list of BubbleData
-   * per variable in multi-map mode
-   */
-  std::vector<std::list<BubbleData> > _bubble_sets;
-
-  /// The scalar counters used during the marking stage of the flood algorithm. Up to one per variable
+  /// The scalar counters used during the marking stage of the flood algorithm. Up to one per variable.  Afterwards the largest bubble id of each map.
   std::vector<unsigned int> _region_counts;
 
+  /// Offset of the first local label of each map: local labels number the local regions of all maps consecutively
+  std::vector<unsigned int> _local_label_offsets;
+
+  /// The merged bubble id of each local label
+  std::vector<unsigned int> _label_ids;
+
+  /// The variable index owning each local label
+  std::vector<unsigned int> _label_var_idx;
+
+  /// The sorted ids of the bubbles of each map
+  std::vector<std::vector<unsigned int> > _bubble_ids;
+
+  /// The bubble id of each owned flooded node at the last finalize, per map (only used when tracking bubble ids)
+  std::vector<std::map<unsigned int, unsigned int> > _previous_ids;
+
+  /// The largest bubble id handed out so far in each map (only used when tracking bubble ids)
+  std::vector<unsigned int> _max_ids;
+
   /// A pointer to the periodic boundary constraints object
   PeriodicBoundaries *_pbs;
 
@@ -247,9 +258,9 @@ protected:
 
   /**
    * The data structure which is a list of nodes that are constrained to other nodes
-   * based on the imposed periodic boundary conditions.
+   * based on the imposed periodic boundary conditions, as sorted (node, paired node) pairs.
    */
-  std::multimap<unsigned int, unsigned int> _periodic_node_map;
+  std::vector<std::pair<dof_id_type, dof_id_type> > _periodic_node_map;
 
   /// The filename and filehandle used if bubble volumes are being recorded to a file.
   std::map<std::string, std::ofstream *> _file_handles;
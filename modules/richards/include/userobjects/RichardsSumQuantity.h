@@ -30,7 +30,7 @@ public:
   void zero();
 
   /**
-   * adds contrib to _total
+   * adds contrib to _total, thread safe
    * @param contrib the amount to add to _total
    */
   void add(Real contrib);
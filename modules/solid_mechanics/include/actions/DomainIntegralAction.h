@@ -45,6 +45,7 @@ protected:
   unsigned int _axis_2d;
   std::vector<Real> _radius_inner;
   std::vector<Real> _radius_outer;
+  bool _single_sweep;
   std::vector<VariableName> _output_variables;
   Real _poissons_ratio;
   Real _youngs_modulus;
@@ -223,6 +223,13 @@ protected:
     return declarePropertyOld<T>(name);
   }
 
+  template<typename T>
+  MaterialProperty<T> & createJacobianProperty(const std::string & prop_name)
+  {
+    std::string name(prop_name + _appended_property_name);
+    return declareJacobianProperty<T>(name);
+  }
+
   virtual void checkElasticConstants();
 
   virtual void createElasticityTensor();
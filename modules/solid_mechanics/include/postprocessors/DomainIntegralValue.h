@@ -0,0 +1,46 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DOMAININTEGRALVALUE_H
+#define DOMAININTEGRALVALUE_H
+
+#include "GeneralPostprocessor.h"
+#include "DomainIntegralSweep.h"
+
+//Forward Declarations
+class DomainIntegralValue;
+
+template<>
+InputParameters validParams<DomainIntegralValue>();
+
+/**
+ * Reports one integral computed by a DomainIntegralSweep
+ */
+class DomainIntegralValue : public GeneralPostprocessor
+{
+public:
+  DomainIntegralValue(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+  virtual Real getValue();
+
+protected:
+  const DomainIntegralSweep & _domain_integral_sweep;
+  const unsigned int _integral;
+  const unsigned int _crack_front_node_index;
+  const unsigned int _ring_index;
+};
+
+#endif //DOMAININTEGRALVALUE_H
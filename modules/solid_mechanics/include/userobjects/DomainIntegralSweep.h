@@ -0,0 +1,99 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DOMAININTEGRALSWEEP_H
+#define DOMAININTEGRALSWEEP_H
+
+#include "ElementUserObject.h"
+#include "CrackFrontDefinition.h"
+#include "SymmTensor.h"
+
+//Forward Declarations
+class DomainIntegralSweep;
+
+template<>
+InputParameters validParams<DomainIntegralSweep>();
+
+/**
+ * Computes the J-integral and the interaction integrals of every crack front
+ * point and ring in a single pass over the elements.  The integrands are the
+ * ones of the JIntegral and InteractionIntegral postprocessors; elements with
+ * no node within reach of the q functions are skipped.  The values are
+ * reported by DomainIntegralValue postprocessors.
+ */
+class DomainIntegralSweep : public ElementUserObject
+{
+public:
+  DomainIntegralSweep(const std::string & name, InputParameters parameters);
+
+  virtual void initialize();
+  virtual void execute();
+  virtual void threadJoin(const UserObject & y);
+  virtual void finalize();
+
+  /**
+   * The value of an integral (a DomainIntegralAction INTEGRAL) for a crack front point and ring,
+   * scaled by the K factor for the interaction integrals.
+   */
+  Real getIntegralValue(unsigned int integral, unsigned int crack_front_node_index, unsigned int ring_index) const;
+
+protected:
+  enum INTEGRAL
+  {
+    J_INTEGRAL,
+    INTERACTION_INTEGRAL_KI,
+    INTERACTION_INTEGRAL_KII,
+    INTERACTION_INTEGRAL_KIII,
+    NUM_INTEGRALS
+  };
+
+  /// Compute the region outside of which all the q functions vanish
+  void updateBoundingBox();
+
+  /// Whether a node of the current element is in the bounding box
+  bool elementInBoundingBox() const;
+
+  const CrackFrontDefinition * const _crack_front_definition;
+  bool _treat_as_2d;
+  unsigned int _num_crack_front_nodes;
+  std::vector<Real> _radius_outer;
+  unsigned int _num_rings;
+
+  /// Gradients of the q functions, the crack front node index varies fastest
+  std::vector<VariableGradient *> _grad_of_scalar_q;
+
+  /// Position of every integral in _integral_values, invalid_uint for those not computed
+  std::vector<unsigned int> _integral_position;
+  std::vector<unsigned int> _interaction_integrals;
+  std::vector<Real> _K_factor;
+
+  MaterialProperty<ColumnMajorMatrix> * _Eshelby_tensor;
+  MaterialProperty<SymmTensor> * _stress;
+  MaterialProperty<SymmTensor> * _strain;
+  VariableGradient * _grad_disp_x;
+  VariableGradient * _grad_disp_y;
+  VariableGradient * _grad_disp_z;
+  std::vector<MaterialProperty<ColumnMajorMatrix> *> _aux_stress;
+  std::vector<MaterialProperty<ColumnMajorMatrix> *> _aux_grad_disp;
+
+  Point _box_min;
+  Point _box_max;
+
+  /// Integrals indexed by ((integral position * rings) + ring) * crack front nodes + crack front node
+  std::vector<Real> _integral_values;
+  /// Contributions of the current element, summed over its quadrature points first like ElementIntegralPostprocessor
+  std::vector<Real> _elem_values;
+};
+
+#endif //DOMAININTEGRALSWEEP_H
@@ -0,0 +1,96 @@
+# Jacobian_mult is declared as a Jacobian-only property by TensorMechanicsMaterial.
+# Here it is read by AuxKernels during residual evaluations only: the problem is
+# unloaded, so the nonlinear solve converges on the initial residual and no
+# Jacobian is ever computed.  The AuxVariables must still hold the elasticity tensor.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+  elem_type = QUAD4
+[]
+
+[Variables]
+  [./disp_x]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+  [./disp_y]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[AuxVariables]
+  [./C1111_aux]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./C1212_aux]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[TensorMechanics]
+  [./solid]
+    disp_x = disp_x
+    disp_y = disp_y
+  [../]
+[]
+
+[AuxKernels]
+  [./matl_C1111]
+    type = RankFourAux
+    rank_four_tensor = Jacobian_mult
+    index_i = 0
+    index_j = 0
+    index_k = 0
+    index_l = 0
+    variable = C1111_aux
+    execute_on = residual
+  [../]
+  [./matl_C1212]
+    type = RankFourAux
+    rank_four_tensor = Jacobian_mult
+    index_i = 0
+    index_j = 1
+    index_k = 0
+    index_l = 1
+    variable = C1212_aux
+    execute_on = residual
+  [../]
+[]
+
+[Materials]
+  [./Anisotropic]
+    type = LinearElasticMaterial
+    block = 0
+    disp_x = disp_x
+    disp_y = disp_y
+    fill_method = symmetric9
+    C_ijkl = '1.0e6  0.0   0.0 1.0e6  0.0  1.0e6 0.5e6 0.5e6 0.5e6'
+  [../]
+[]
+
+[Postprocessors]
+  [./C1111]
+    type = ElementAverageValue
+    variable = C1111_aux
+  [../]
+  [./C1212]
+    type = ElementAverageValue
+    variable = C1212_aux
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  output_initial = false
+  csv = true
+[]
@@ -35,6 +35,10 @@ public:
 
   virtual void addPoints();
   virtual Real computeQpResidual();
+
+protected:
+  /// Whether to add the points with a single addPointList() call
+  bool _use_point_list;
 };
 
 #endif //CACHINGPOINTSOURCE_H
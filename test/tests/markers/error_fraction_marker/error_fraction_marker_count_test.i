@@ -0,0 +1,91 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  nz = 10
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Functions]
+  [./solution]
+    type = ParsedFunction
+    value = (exp(x)-1)/(exp(1)-1)
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./conv]
+    type = Convection
+    variable = u
+    velocity = '1 0 0'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+[]
+
+[Adaptivity]
+  steps = 1
+  marker = marker
+  [./Indicators]
+    [./error]
+      type = AnalyticalIndicator
+      variable = u
+      function = solution
+    [../]
+  [../]
+  [./Markers]
+    [./marker]
+      type = ErrorFractionMarker
+      mode = element_count
+      # 30 of the 100 elements get refined into 4
+      target_elements = 190
+      indicator = error
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  # Counts the refined parents as well: 190 active + 30
+  [./num_elems]
+    type = NumElems
+  [../]
+[]
+
+[Outputs]
+  [./console]
+    type = Console
+    perf_log = true
+    linear_residuals = true
+  [../]
+[]
@@ -0,0 +1,97 @@
+# u = 0 and the function is x, so the error of the elements in column j of the mesh is
+# proportional to (j+1)^3 - j^3, with a total of 1000 over a column of every width.
+# refine = 0.3 selects the columns 9 and 8 (271 + 217 >= 300) and coarsen = 0.1 the
+# columns 0 to 3 (1 + 7 + 19 + 37 <= 100 < 1 + 7 + 19 + 37 + 61).
+# The markers are computed at the end of a step, so they are sampled in the second step.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  [./solution]
+    type = ParsedFunction
+    value = x
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+[]
+
+[Adaptivity]
+  [./Indicators]
+    [./error]
+      type = AnalyticalIndicator
+      variable = u
+      function = solution
+    [../]
+  [../]
+  [./Markers]
+    [./marker]
+      type = ErrorFractionMarker
+      mode = error_fraction
+      coarsen = 0.1
+      indicator = error
+      refine = 0.3
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./average]
+    type = ElementAverageValue
+    variable = marker
+  [../]
+  [./col0]
+    type = PointValue
+    variable = marker
+    point = '0.05 0.55 0'
+  [../]
+  [./col3]
+    type = PointValue
+    variable = marker
+    point = '0.35 0.55 0'
+  [../]
+  [./col4]
+    type = PointValue
+    variable = marker
+    point = '0.45 0.55 0'
+  [../]
+  [./col7]
+    type = PointValue
+    variable = marker
+    point = '0.75 0.55 0'
+  [../]
+  [./col8]
+    type = PointValue
+    variable = marker
+    point = '0.85 0.55 0'
+  [../]
+  [./col9]
+    type = PointValue
+    variable = marker
+    point = '0.95 0.55 0'
+  [../]
+[]
+
+[Outputs]
+  output_initial = false
+  csv = true
+[]
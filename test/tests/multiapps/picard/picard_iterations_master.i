@@ -0,0 +1,98 @@
+# Linear, spatially constant coupling with a known Picard contraction:
+#   master: 2 u = v + t
+#   sub:    2 v = u + 1
+# Each plain Picard iteration reduces the master residual by a factor of 4, so
+# reaching picard_rel_tol = 1e-7 takes 12 solves per step.  Aitken and Anderson
+# (secant steps on a linear scalar map) land on the fixed point after the third solve.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  distribution = serial
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./reaction]
+    type = Reaction
+    variable = u
+  [../]
+  [./reaction_again]
+    type = Reaction
+    variable = u
+  [../]
+  [./force_v]
+    type = CoupledForce
+    variable = u
+    v = v
+  [../]
+  [./force_t]
+    type = BodyForce
+    variable = u
+    value = 1
+    function = t
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  picard_max_its = 30
+  picard_rel_tol = 1e-7
+[]
+
+[Postprocessors]
+  [./picard_its]
+    type = NumPicardIterations
+  [../]
+  [./u_avg]
+    # Fixed point: u = (1 + 2 t) / 3
+    type = ElementAverageValue
+    variable = u
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    positions = '0 0 0'
+    input_files = picard_iterations_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./v_from_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = v
+    variable = v
+  [../]
+  [./u_to_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = to_multiapp
+    execute_on = timestep
+    multi_app = sub
+    source_variable = u
+    variable = u
+  [../]
+[]
@@ -0,0 +1,46 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./v]
+  [../]
+[]
+
+[AuxVariables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./reaction]
+    type = Reaction
+    variable = v
+  [../]
+  [./reaction_again]
+    type = Reaction
+    variable = v
+  [../]
+  [./force_u]
+    type = CoupledForce
+    variable = v
+    v = u
+  [../]
+  [./force_one]
+    type = BodyForce
+    variable = v
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
@@ -0,0 +1,82 @@
+# Nothing is solved, so the only objects called are the two AuxKernels, once per node
+# (11 x 11) and once per element (10 x 10) at the end of every time step, and the
+# v_aux postprocessor once per node (11) of the left boundary. The postprocessor
+# shares its name with the AuxKernel but is timed separately under its own base.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+  [./w]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[AuxKernels]
+  [./v_aux]
+    type = ConstantAux
+    variable = v
+    value = 1
+    execute_on = timestep
+  [../]
+  [./w_aux]
+    type = ConstantAux
+    variable = w
+    value = 2
+    execute_on = timestep
+  [../]
+[]
+
+[Postprocessors]
+  [./v_aux]
+    type = NodalMaxValue
+    variable = v
+    boundary = left
+  [../]
+  [./v_aux_calls]
+    type = ObjectPerformanceData
+    column = n_calls
+    object = v_aux
+    object_base = AuxKernel
+  [../]
+  [./v_aux_pp_calls]
+    type = ObjectPerformanceData
+    column = n_calls
+    object = v_aux
+    object_base = Postprocessor
+  [../]
+  [./w_aux_calls]
+    type = ObjectPerformanceData
+    column = n_calls
+    object = w_aux
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+[]
+
+[Outputs]
+  output_initial = false
+  csv = true
+[]
@@ -38,6 +38,11 @@
     column = n_calls
     event = compute_residual()
   [../]
+  [./solve_res_calls]
+    type = PerformanceData
+    column = n_calls
+    event = 'solve()/compute_residual()'
+  [../]
   [./jac_calls]
     type = PerformanceData
     column = n_calls
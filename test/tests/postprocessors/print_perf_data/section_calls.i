@@ -0,0 +1,86 @@
+# A linear problem solved with Newton, LU and no line search converges in a single Newton step:
+# one residual for the initial norm, one at the start of the SNES solve, one after the step, and
+# a single Jacobian. The counts are read at several depths of the profiler call tree.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./res_evals]
+    type = NumResidualEvaluations
+  [../]
+  [./res_calls]
+    type = PerformanceData
+    column = n_calls
+    event = compute_residual()
+  [../]
+  [./solve_res_calls]
+    type = PerformanceData
+    column = n_calls
+    event = 'solve()/compute_residual()'
+  [../]
+  [./res_thread_calls]
+    type = PerformanceData
+    column = n_calls
+    event = 'solve()/compute_residual()/ComputeResidualThread'
+  [../]
+  [./jac_calls]
+    type = PerformanceData
+    column = n_calls
+    event = 'solve()/compute_jacobian()'
+  [../]
+  [./jac_thread_calls]
+    type = PerformanceData
+    column = n_calls
+    event = 'solve()/compute_jacobian()/ComputeJacobianThread'
+  [../]
+  [./res_thread_in_jac_calls]
+    # Not a node of the tree
+    type = PerformanceData
+    column = n_calls
+    event = 'solve()/compute_jacobian()/ComputeResidualThread'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  line_search = none
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,88 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 8
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Preconditioning]
+  [./FDP]
+    type = FDP
+    lag_jacobian = 2
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./cubic]
+    # flux u'^3
+    type = PHarmonic
+    variable = u
+    p = 4
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Adaptivity]
+  # Refine everything once, before the third step, so the coloring is rebuilt for the new mesh
+  marker = uniform
+  start_time = 0.4
+  stop_time = 0.6
+  [./Markers]
+    [./uniform]
+      type = UniformMarker
+      mark = refine
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./nl_its]
+    type = NumNonlinearIterations
+  [../]
+  [./u_avg]
+    type = ElementAverageValue
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 0.25
+
+  solve_type = NEWTON
+  line_search = none
+
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,39 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPRESSEDCONNECTIVITYTEST_H
+#define COMPRESSEDCONNECTIVITYTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class CompressedConnectivityTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( CompressedConnectivityTest );
+
+  CPPUNIT_TEST( buildTest );
+  CPPUNIT_TEST( emptyTest );
+  CPPUNIT_TEST( compareToMapTest );
+  CPPUNIT_TEST( pairTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void buildTest();
+  void emptyTest();
+  void compareToMapTest();
+  void pairTest();
+};
+
+#endif  // COMPRESSEDCONNECTIVITYTEST_H
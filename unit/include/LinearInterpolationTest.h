@@ -25,6 +25,10 @@ class LinearInterpolationTest : public CppUnit::TestFixture
   CPPUNIT_TEST( constructor );
   CPPUNIT_TEST( sample );
   CPPUNIT_TEST( getSampleSize );
+  CPPUNIT_TEST( sampleHint );
+  CPPUNIT_TEST( sampleUniform );
+  CPPUNIT_TEST( sampleVector );
+  CPPUNIT_TEST( sampleLargeTable );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -35,6 +39,10 @@ public:
   void constructor();
   void sample();
   void getSampleSize();
+  void sampleHint();
+  void sampleUniform();
+  void sampleVector();
+  void sampleLargeTable();
 
 private:
   std::vector<double> * _x;
@@ -0,0 +1,48 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PERIODICNODEMAPTEST_H
+#define PERIODICNODEMAPTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Forward declarations
+class MooseMesh;
+class Factory;
+class MooseApp;
+
+class PeriodicNodeMapTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( PeriodicNodeMapTest );
+
+  CPPUNIT_TEST( squareTest );
+  CPPUNIT_TEST( cubeTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void squareTest();
+  void cubeTest();
+
+protected:
+  void init(const std::string & dim, const std::string & elem_type, int n);
+  void finalize();
+
+  MooseApp * _app;
+  Factory * _factory;
+  MooseMesh * _mesh;
+};
+
+#endif  // PERIODICNODEMAPTEST_H
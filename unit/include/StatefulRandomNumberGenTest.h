@@ -27,11 +27,13 @@ class StatefulRandomNumberGenTest : public CppUnit::TestFixture
   CPPUNIT_TEST_SUITE( StatefulRandomNumberGenTest );
 
   CPPUNIT_TEST( testRandomGen );
+  CPPUNIT_TEST( testCounterBasedGen );
 
   CPPUNIT_TEST_SUITE_END();
 
 public:
   void testRandomGen();
+  void testCounterBasedGen();
 };
 
 #endif  // STATEFULRANDOMNUMBERGENTEST_H
@@ -0,0 +1,53 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef WATERSTEAMEOSTEST_H
+#define WATERSTEAMEOSTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Forward declarations
+class MooseMesh;
+class FEProblem;
+class MooseApp;
+class WaterSteamEOS;
+
+class WaterSteamEOSTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( WaterSteamEOSTest );
+
+  CPPUNIT_TEST( tableMatchesCorrelations );
+  CPPUNIT_TEST( batchedMatchesPointwise );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void tableMatchesCorrelations();
+  void batchedMatchesPointwise();
+
+  void init();
+  void finalize();
+
+protected:
+  /// Builds a WaterSteamEOS, tabulated over 1 - 15 MPa and 0.2 - 3.2 MJ/kg when requested
+  WaterSteamEOS * buildEOS(const std::string & name, bool tabulated);
+
+  MooseApp * _app;
+  MooseMesh * _mesh;
+  FEProblem * _fe_problem;
+};
+
+#endif  // WATERSTEAMEOSTEST_H